@@ -1,5 +1,6 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
+using System.IO;
 using UnrealBuildTool;
 
 public class ClaudeTest : ModuleRules
@@ -22,6 +23,9 @@ public class ClaudeTest : ModuleRules
 			// Common private deps here if any
 		});
 
+		// Engine-independent island connectivity core, also built standalone from Tools/IslandCore
+		PublicIncludePaths.Add(Path.Combine(ModuleDirectory, "IslandCore"));
+
 		if (Target.bBuildEditor)
 		{
 			PrivateDependencyModuleNames.AddRange(new string[] {
@@ -108,6 +108,7 @@ void AClaudeTestCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInpu
 
 		// Voxel Tools
 		EnhancedInputComponent->BindAction(DigAction, ETriggerEvent::Triggered, this, &AClaudeTestCharacter::Dig);
+		EnhancedInputComponent->BindAction(DigAction, ETriggerEvent::Completed, this, &AClaudeTestCharacter::StopDig);
 		EnhancedInputComponent->BindAction(BuildAction, ETriggerEvent::Triggered, this, &AClaudeTestCharacter::Build);
 		EnhancedInputComponent->BindAction(IncreaseToolSizeAction, ETriggerEvent::Triggered, this, &AClaudeTestCharacter::IncreaseToolSize);
 		EnhancedInputComponent->BindAction(DecreaseToolSizeAction, ETriggerEvent::Triggered, this, &AClaudeTestCharacter::DecreaseToolSize);
@@ -162,6 +163,14 @@ void AClaudeTestCharacter::Dig(const FInputActionValue& Value)
 	}
 }
 
+void AClaudeTestCharacter::StopDig(const FInputActionValue& Value)
+{
+	if (VoxelToolComponent)
+	{
+		VoxelToolComponent->EndDigStroke();
+	}
+}
+
 void AClaudeTestCharacter::Build(const FInputActionValue& Value)
 {
 	if (VoxelToolComponent)
@@ -92,6 +92,9 @@ protected:
 	/** Called for voxel dig input */
 	void Dig(const FInputActionValue& Value);
 
+	/** Called when voxel dig input is released */
+	void StopDig(const FInputActionValue& Value);
+
 	/** Called for voxel build input */
 	void Build(const FInputActionValue& Value);
 
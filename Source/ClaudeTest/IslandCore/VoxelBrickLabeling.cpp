@@ -0,0 +1,333 @@
+// VoxelBrickLabeling.cpp
+#include "VoxelBrickLabeling.h"
+#include "VoxelGroundAnchorIndex.h"
+
+// Bit = Y * 8 + X inside a word
+static constexpr uint64 BrickColumnX0 = 0x0101010101010101ull;
+static constexpr uint64 BrickColumnX7 = 0x8080808080808080ull;
+static constexpr uint64 BrickRowY0 = 0x00000000000000FFull;
+static constexpr uint64 BrickRowY7 = 0xFF00000000000000ull;
+
+// Grows Seed inside Solid until it stops changing. Shifts by 1 move along X (masked so rows don't
+// wrap), shifts by 8 move along Y, neighboring words move along Z.
+static void GrowInBrick(const uint64* Solid, uint64* Seed)
+{
+	bool bChanged = true;
+	while (bChanged)
+	{
+		bChanged = false;
+		for (int32 Z = 0; Z < FVoxelIslandBitGrid::WordsPerBrick; Z++)
+		{
+			const uint64 Word = Seed[Z];
+			uint64 Grown = Word
+				| ((Word << 1) & ~BrickColumnX0)
+				| ((Word >> 1) & ~BrickColumnX7)
+				| (Word << 8)
+				| (Word >> 8);
+			if (Z > 0)
+			{
+				Grown |= Seed[Z - 1];
+			}
+			if (Z < FVoxelIslandBitGrid::WordsPerBrick - 1)
+			{
+				Grown |= Seed[Z + 1];
+			}
+			Grown &= Solid[Z];
+
+			if (Grown != Word)
+			{
+				Seed[Z] = Grown;
+				bChanged = true;
+			}
+		}
+	}
+}
+
+void FVoxelBrickLabeling::Label(const FVoxelIslandBitGrid& Solid, const FVoxelGroundAnchorIndex* Anchors)
+{
+	Grid = &Solid;
+
+	const int32 NumBricks = Solid.NumBricks.X * Solid.NumBricks.Y * Solid.NumBricks.Z;
+
+	ComponentMasks.Reset();
+	ComponentBrick.Reset();
+	Parent.Reset();
+	BrickFirstComponent.Reset();
+	BrickFirstComponent.Reserve(NumBricks + 1);
+
+	// Pass 1: components inside each brick
+	for (int32 BZ = 0; BZ < Solid.NumBricks.Z; BZ++)
+	{
+		for (int32 BY = 0; BY < Solid.NumBricks.Y; BY++)
+		{
+			for (int32 BX = 0; BX < Solid.NumBricks.X; BX++)
+			{
+				const int32 BrickIndex = BX + Solid.NumBricks.X * (BY + Solid.NumBricks.Y * BZ);
+				BrickFirstComponent.Add(ComponentBrick.Num());
+				LabelBrick(BrickIndex);
+			}
+		}
+	}
+	BrickFirstComponent.Add(ComponentBrick.Num());
+
+	// Pass 2: join components through the +X, +Y and +Z faces of each brick
+	for (int32 BZ = 0; BZ < Solid.NumBricks.Z; BZ++)
+	{
+		for (int32 BY = 0; BY < Solid.NumBricks.Y; BY++)
+		{
+			for (int32 BX = 0; BX < Solid.NumBricks.X; BX++)
+			{
+				const int32 BrickIndex = BX + Solid.NumBricks.X * (BY + Solid.NumBricks.Y * BZ);
+				if (BrickFirstComponent[BrickIndex] == BrickFirstComponent[BrickIndex + 1])
+				{
+					continue;
+				}
+
+				if (BX + 1 < Solid.NumBricks.X)
+				{
+					JoinBricks(BrickIndex, BrickIndex + 1, 0);
+				}
+				if (BY + 1 < Solid.NumBricks.Y)
+				{
+					JoinBricks(BrickIndex, BrickIndex + Solid.NumBricks.X, 1);
+				}
+				if (BZ + 1 < Solid.NumBricks.Z)
+				{
+					JoinBricks(BrickIndex, BrickIndex + Solid.NumBricks.X * Solid.NumBricks.Y, 2);
+				}
+			}
+		}
+	}
+
+	// Pass 3: per-root size and grounding
+	const int32 NumComponents = Parent.Num();
+	RootVoxelCount.Reset();
+	RootVoxelCount.SetNumZeroed(NumComponents);
+	RootGrounded.Reset();
+	RootGrounded.SetNumZeroed(NumComponents);
+
+	const FIntVector Size = Solid.Max - Solid.Min + FIntVector(1);
+
+	// A flat ground level is a whole-slice test; anything else is checked voxel by voxel
+	const int32 GroundLevel = Anchors ? Anchors->GetGroundLevel() : 0;
+	const FVoxelGroundAnchorIndex* DetailedAnchors = Anchors && !Anchors->IsGroundLevelOnly() ? Anchors : nullptr;
+
+	for (int32 Component = 0; Component < NumComponents; Component++)
+	{
+		const int32 Root = FindRoot(Component);
+		const uint64* Mask = GetComponentMask(Component);
+
+		const int32 BrickIndex = ComponentBrick[Component];
+		const FIntVector BrickCoord(
+			BrickIndex % Solid.NumBricks.X,
+			(BrickIndex / Solid.NumBricks.X) % Solid.NumBricks.Y,
+			BrickIndex / (Solid.NumBricks.X * Solid.NumBricks.Y));
+		const FIntVector BrickOrigin = BrickCoord * FVoxelIslandBitGrid::BrickSize;
+
+		// Bits lying on the grid faces, where the component may continue into unknown space
+		uint64 EdgeMask = 0;
+		if (BrickOrigin.X == 0) EdgeMask |= BrickColumnX0;
+		if (BrickOrigin.X + 8 >= Size.X) EdgeMask |= BrickColumnX0 << ((Size.X - 1) & 7);
+		if (BrickOrigin.Y == 0) EdgeMask |= BrickRowY0;
+		if (BrickOrigin.Y + 8 >= Size.Y) EdgeMask |= BrickRowY0 << (((Size.Y - 1) & 7) * 8);
+
+		const int32 LastZ = BrickOrigin.Z + 8 >= Size.Z ? (Size.Z - 1) & 7 : INDEX_NONE;
+
+		int64 Count = 0;
+		bool bGrounded = false;
+		for (int32 Z = 0; Z < WordsPerBrick; Z++)
+		{
+			if (Mask[Z] == 0)
+			{
+				continue;
+			}
+
+			Count += FMath::CountBits(Mask[Z]);
+
+			if (bGrounded)
+			{
+				continue;
+			}
+
+			const bool bEdgeSlice = (BrickOrigin.Z == 0 && Z == 0) || Z == LastZ;
+			const FIntVector SliceOrigin = Solid.Min + BrickOrigin + FIntVector(0, 0, Z);
+			if (SliceOrigin.Z <= GroundLevel || bEdgeSlice || (Mask[Z] & EdgeMask) != 0 ||
+				(DetailedAnchors && SliceTouchesAnchor(SliceOrigin, Mask[Z], *DetailedAnchors)))
+			{
+				bGrounded = true;
+			}
+		}
+
+		RootVoxelCount[Root] += Count;
+		RootGrounded[Root] |= bGrounded;
+	}
+}
+
+bool FVoxelBrickLabeling::SliceTouchesAnchor(const FIntVector& SliceOrigin, uint64 Word, const FVoxelGroundAnchorIndex& Anchors) const
+{
+	while (Word != 0)
+	{
+		const int32 Bit = int32(FMath::CountTrailingZeros64(Word));
+		Word &= Word - 1;
+
+		if (Anchors.IsAnchor(SliceOrigin + FIntVector(Bit & 7, Bit >> 3, 0)))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FVoxelBrickLabeling::LabelBrick(int32 BrickIndex)
+{
+	const uint64* Solid = &Grid->Words[BrickIndex * WordsPerBrick];
+
+	uint64 Remaining[WordsPerBrick];
+	FMemory::Memcpy(Remaining, Solid, sizeof(Remaining));
+
+	for (int32 Z = 0; Z < WordsPerBrick; Z++)
+	{
+		while (Remaining[Z] != 0)
+		{
+			// Seed from the lowest remaining bit and grow it to its full component
+			uint64 Component[WordsPerBrick] = {};
+			Component[Z] = Remaining[Z] & (~Remaining[Z] + 1);
+			GrowInBrick(Solid, Component);
+
+			for (int32 W = 0; W < WordsPerBrick; W++)
+			{
+				Remaining[W] &= ~Component[W];
+				ComponentMasks.Add(Component[W]);
+			}
+
+			ComponentBrick.Add(BrickIndex);
+			Parent.Add(Parent.Num());
+		}
+	}
+}
+
+void FVoxelBrickLabeling::JoinBricks(int32 BrickA, int32 BrickB, int32 Axis)
+{
+	const int32 FirstB = BrickFirstComponent[BrickB];
+	const int32 EndB = BrickFirstComponent[BrickB + 1];
+	if (FirstB == EndB)
+	{
+		return;
+	}
+
+	for (int32 A = BrickFirstComponent[BrickA]; A < BrickFirstComponent[BrickA + 1]; A++)
+	{
+		const uint64* MaskA = GetComponentMask(A);
+
+		// Far face of A, moved onto the near face of B
+		uint64 FaceA[WordsPerBrick] = {};
+		bool bAnyFace = false;
+		for (int32 Z = 0; Z < WordsPerBrick; Z++)
+		{
+			switch (Axis)
+			{
+			case 0: FaceA[Z] = (MaskA[Z] & BrickColumnX7) >> 7; break;
+			case 1: FaceA[Z] = (MaskA[Z] & BrickRowY7) >> 56; break;
+			default: FaceA[Z] = Z == 0 ? MaskA[WordsPerBrick - 1] : 0; break;
+			}
+			bAnyFace |= FaceA[Z] != 0;
+		}
+
+		if (!bAnyFace)
+		{
+			continue;
+		}
+
+		for (int32 B = FirstB; B < EndB; B++)
+		{
+			const uint64* MaskB = GetComponentMask(B);
+			for (int32 Z = 0; Z < WordsPerBrick; Z++)
+			{
+				if ((FaceA[Z] & MaskB[Z]) != 0)
+				{
+					Union(A, B);
+					break;
+				}
+			}
+		}
+	}
+}
+
+int32 FVoxelBrickLabeling::FindRoot(int32 Component)
+{
+	while (Parent[Component] != Component)
+	{
+		Parent[Component] = Parent[Parent[Component]];
+		Component = Parent[Component];
+	}
+	return Component;
+}
+
+void FVoxelBrickLabeling::Union(int32 A, int32 B)
+{
+	A = FindRoot(A);
+	B = FindRoot(B);
+	if (A != B)
+	{
+		// Lower index wins so roots stay stable regardless of join order
+		if (A < B)
+		{
+			Parent[B] = A;
+		}
+		else
+		{
+			Parent[A] = B;
+		}
+	}
+}
+
+int32 FVoxelBrickLabeling::FindComponentAt(const FIntVector& Pos)
+{
+	if (!Grid || !Grid->Contains(Pos))
+	{
+		return INDEX_NONE;
+	}
+
+	const FIntVector Local = Pos - Grid->Min;
+	const int32 BrickIndex = (Local.X >> 3) + Grid->NumBricks.X * ((Local.Y >> 3) + Grid->NumBricks.Y * (Local.Z >> 3));
+	const int32 Word = Local.Z & 7;
+	const uint64 Bit = uint64(1) << ((Local.Y & 7) * 8 + (Local.X & 7));
+
+	for (int32 Component = BrickFirstComponent[BrickIndex]; Component < BrickFirstComponent[BrickIndex + 1]; Component++)
+	{
+		if (GetComponentMask(Component)[Word] & Bit)
+		{
+			return FindRoot(Component);
+		}
+	}
+	return INDEX_NONE;
+}
+
+void FVoxelBrickLabeling::GatherVoxels(int32 Root, TArray<FIntVector>& OutVoxels)
+{
+	for (int32 Component = 0; Component < Parent.Num(); Component++)
+	{
+		if (FindRoot(Component) != Root)
+		{
+			continue;
+		}
+
+		const int32 BrickIndex = ComponentBrick[Component];
+		const FIntVector BrickOrigin = Grid->Min + FIntVector(
+			BrickIndex % Grid->NumBricks.X,
+			(BrickIndex / Grid->NumBricks.X) % Grid->NumBricks.Y,
+			BrickIndex / (Grid->NumBricks.X * Grid->NumBricks.Y)) * FVoxelIslandBitGrid::BrickSize;
+
+		const uint64* Mask = GetComponentMask(Component);
+		for (int32 Z = 0; Z < WordsPerBrick; Z++)
+		{
+			uint64 Bits = Mask[Z];
+			while (Bits != 0)
+			{
+				const int32 Bit = int32(FMath::CountTrailingZeros64(Bits));
+				Bits &= Bits - 1;
+				OutVoxels.Add(BrickOrigin + FIntVector(Bit & 7, Bit >> 3, Z));
+			}
+		}
+	}
+}
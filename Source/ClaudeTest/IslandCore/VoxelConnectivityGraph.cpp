@@ -0,0 +1,639 @@
+// VoxelConnectivityGraph.cpp
+#include "VoxelConnectivityGraph.h"
+#include "VoxelIsland.h"
+#include "VoxelOccupancyBuffer.h"
+#include "VoxelOccupancyPyramid.h"
+#include "VoxelData/VoxelData.h"
+#include "VoxelData/VoxelDataIncludes.h"
+#include "VoxelIntBox.h"
+
+void FVoxelConnectivityGraph::Invalidate(const FIntVector& Min, const FIntVector& Max)
+{
+	// One voxel of margin so edits on a cluster face also refresh the cluster across it
+	const FIntVector ClusterMin = GetClusterCoord(Min - FIntVector(1));
+	const FIntVector ClusterMax = GetClusterCoord(Max + FIntVector(1));
+
+	int32 NumRemoved = 0;
+	for (int32 Z = ClusterMin.Z; Z <= ClusterMax.Z; Z++)
+	{
+		for (int32 Y = ClusterMin.Y; Y <= ClusterMax.Y; Y++)
+		{
+			for (int32 X = ClusterMin.X; X <= ClusterMax.X; X++)
+			{
+				TUniquePtr<FCluster> Removed;
+				if (Clusters.RemoveAndCopyValue(FIntVector(X, Y, Z), Removed))
+				{
+					RecycleCluster(MoveTemp(Removed));
+					NumRemoved++;
+				}
+			}
+		}
+	}
+
+	if (NumRemoved == 0)
+	{
+		return;
+	}
+
+	// Links of the ring around the removed clusters point at component indices that no longer exist
+	for (int32 Z = ClusterMin.Z - 1; Z <= ClusterMax.Z + 1; Z++)
+	{
+		for (int32 Y = ClusterMin.Y - 1; Y <= ClusterMax.Y + 1; Y++)
+		{
+			for (int32 X = ClusterMin.X - 1; X <= ClusterMax.X + 1; X++)
+			{
+				if (TUniquePtr<FCluster>* Neighbor = Clusters.Find(FIntVector(X, Y, Z)))
+				{
+					(*Neighbor)->bLinksValid = false;
+				}
+			}
+		}
+	}
+}
+
+void FVoxelConnectivityGraph::Reset()
+{
+	for (auto It = Clusters.CreateIterator(); It; ++It)
+	{
+		RecycleCluster(MoveTemp(It.Value()));
+	}
+	Clusters.Reset();
+}
+
+void FVoxelConnectivityGraph::RecycleCluster(TUniquePtr<FCluster> Cluster)
+{
+	if (FreeClusters.Num() < MaxFreeClusters)
+	{
+		FreeClusters.Add(MoveTemp(Cluster));
+	}
+}
+
+FVoxelConnectivityGraph::FCluster& FVoxelConnectivityGraph::GetOrBuildCluster(const FVoxelData& Data, const FIntVector& ClusterCoord)
+{
+	QueryClusterMin = FIntVector(FMath::Min(QueryClusterMin.X, ClusterCoord.X), FMath::Min(QueryClusterMin.Y, ClusterCoord.Y), FMath::Min(QueryClusterMin.Z, ClusterCoord.Z));
+	QueryClusterMax = FIntVector(FMath::Max(QueryClusterMax.X, ClusterCoord.X), FMath::Max(QueryClusterMax.Y, ClusterCoord.Y), FMath::Max(QueryClusterMax.Z, ClusterCoord.Z));
+
+	if (TUniquePtr<FCluster>* Existing = Clusters.Find(ClusterCoord))
+	{
+		return **Existing;
+	}
+
+	TUniquePtr<FCluster>& NewCluster = Clusters.Add(ClusterCoord, FreeClusters.Num() > 0 ? FreeClusters.Pop(EAllowShrinking::No) : MakeUnique<FCluster>());
+	BuildCluster(Data, ClusterCoord, *NewCluster);
+	return *NewCluster;
+}
+
+void FVoxelConnectivityGraph::BuildCluster(const FVoxelData& Data, const FIntVector& ClusterCoord, FCluster& Cluster)
+{
+	const FIntVector Origin = ClusterCoord * ClusterSize;
+
+	static_assert(ClusterShift == FVoxelOccupancyPyramid::CellShift, "Clusters must map to pyramid cells");
+
+	FVoxelOccupancyBuffer& Occupancy = BuildOccupancy;
+	const EVoxelOccupancyState State = Pyramid ? Pyramid->GetCellState(ClusterCoord) : EVoxelOccupancyState::Unknown;
+	if (State == EVoxelOccupancyState::Empty || State == EVoxelOccupancyState::Full)
+	{
+		Occupancy.Fill(Origin, Origin + FIntVector(ClusterSize - 1), State == EVoxelOccupancyState::Full);
+	}
+	else
+	{
+		Occupancy.Read(Data, Origin, Origin + FIntVector(ClusterSize - 1));
+		if (Pyramid)
+		{
+			Pyramid->SetCellFromGrid(ClusterCoord, Occupancy.Solid);
+		}
+	}
+
+	TArray<bool>& Solid = BuildSolid;
+	Solid.SetNumUninitialized(VoxelsPerCluster, EAllowShrinking::No);
+	for (int32 Z = 0; Z < ClusterSize; Z++)
+	{
+		for (int32 Y = 0; Y < ClusterSize; Y++)
+		{
+			for (int32 X = 0; X < ClusterSize; X++)
+			{
+				Solid[LocalIndex(X, Y, Z)] = Occupancy.IsSolid(Origin + FIntVector(X, Y, Z));
+			}
+		}
+	}
+
+	Cluster.Labels.Reset();
+	Cluster.Labels.SetNumZeroed(VoxelsPerCluster);
+	Cluster.ComponentSizes.Reset();
+	Cluster.ComponentGrounded.Reset();
+	Cluster.bLinksValid = false;
+
+	// Label 6-connected components inside the cluster
+	TArray<int32>& Stack = BuildStack;
+	for (int32 StartIndex = 0; StartIndex < VoxelsPerCluster; StartIndex++)
+	{
+		if (!Solid[StartIndex] || Cluster.Labels[StartIndex] != 0)
+		{
+			continue;
+		}
+
+		const uint16 Label = uint16(Cluster.ComponentSizes.Num() + 1);
+		int32 Size = 0;
+		bool bGrounded = false;
+
+		Stack.Reset();
+		Stack.Add(StartIndex);
+		Cluster.Labels[StartIndex] = Label;
+
+		while (Stack.Num() > 0)
+		{
+			const int32 Index = Stack.Pop(EAllowShrinking::No);
+			const int32 X = Index & (ClusterSize - 1);
+			const int32 Y = (Index >> ClusterShift) & (ClusterSize - 1);
+			const int32 Z = Index >> (2 * ClusterShift);
+			Size++;
+
+			// Same anchor rule as the flood fill ground search
+			if (!bGrounded && (Anchors.IsValid() ? Anchors->IsAnchor(Origin + FIntVector(X, Y, Z)) : Origin.Z + Z <= 0))
+			{
+				bGrounded = true;
+			}
+
+			auto Visit = [&](int32 NX, int32 NY, int32 NZ)
+			{
+				const int32 NeighborIndex = LocalIndex(NX, NY, NZ);
+				if (Solid[NeighborIndex] && Cluster.Labels[NeighborIndex] == 0)
+				{
+					Cluster.Labels[NeighborIndex] = Label;
+					Stack.Add(NeighborIndex);
+				}
+			};
+
+			if (X > 0) Visit(X - 1, Y, Z);
+			if (X < ClusterSize - 1) Visit(X + 1, Y, Z);
+			if (Y > 0) Visit(X, Y - 1, Z);
+			if (Y < ClusterSize - 1) Visit(X, Y + 1, Z);
+			if (Z > 0) Visit(X, Y, Z - 1);
+			if (Z < ClusterSize - 1) Visit(X, Y, Z + 1);
+		}
+
+		Cluster.ComponentSizes.Add(Size);
+		Cluster.ComponentGrounded.Add(bGrounded);
+	}
+}
+
+void FVoxelConnectivityGraph::BuildLinks(const FVoxelData& Data, const FIntVector& ClusterCoord, FCluster& Cluster)
+{
+	// Inner arrays of a recycled cluster keep their memory
+	Cluster.ComponentLinks.SetNum(Cluster.NumComponents(), EAllowShrinking::No);
+	for (TArray<FVoxelConnectivityNode>& Links : Cluster.ComponentLinks)
+	{
+		Links.Reset();
+	}
+
+	if (Cluster.NumComponents() > 0)
+	{
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			for (int32 Sign = -1; Sign <= 1; Sign += 2)
+			{
+				FIntVector Offset = FIntVector::ZeroValue;
+				Offset[Axis] = Sign;
+				const FIntVector NeighborCoord = ClusterCoord + Offset;
+				const FCluster& Neighbor = GetOrBuildCluster(Data, NeighborCoord);
+				if (Neighbor.NumComponents() == 0)
+				{
+					continue;
+				}
+
+				// Face slice on our side and the touching slice on the neighbor's side
+				const int32 OwnSlice = Sign > 0 ? ClusterSize - 1 : 0;
+				const int32 NeighborSlice = Sign > 0 ? 0 : ClusterSize - 1;
+				const int32 AxisU = (Axis + 1) % 3;
+				const int32 AxisV = (Axis + 2) % 3;
+
+				for (int32 V = 0; V < ClusterSize; V++)
+				{
+					for (int32 U = 0; U < ClusterSize; U++)
+					{
+						FIntVector Local;
+						Local[Axis] = OwnSlice;
+						Local[AxisU] = U;
+						Local[AxisV] = V;
+						const uint16 OwnLabel = Cluster.Labels[LocalIndex(Local.X, Local.Y, Local.Z)];
+						if (OwnLabel == 0)
+						{
+							continue;
+						}
+
+						Local[Axis] = NeighborSlice;
+						const uint16 NeighborLabel = Neighbor.Labels[LocalIndex(Local.X, Local.Y, Local.Z)];
+						if (NeighborLabel == 0)
+						{
+							continue;
+						}
+
+						Cluster.ComponentLinks[OwnLabel - 1].AddUnique(FVoxelConnectivityNode(NeighborCoord, NeighborLabel - 1));
+					}
+				}
+			}
+		}
+	}
+
+	Cluster.bLinksValid = true;
+}
+
+void FVoxelConnectivityGraph::GatherVoxels(const FVoxelConnectivityNode& Node, TArray<FIntVector>& OutVoxels) const
+{
+	const FCluster& Cluster = *Clusters.FindChecked(Node.Cluster);
+	const FIntVector Origin = Node.Cluster * ClusterSize;
+	const uint16 Label = uint16(Node.Component + 1);
+
+	for (int32 Index = 0; Index < VoxelsPerCluster; Index++)
+	{
+		if (Cluster.Labels[Index] == Label)
+		{
+			OutVoxels.Add(Origin + FIntVector(
+				Index & (ClusterSize - 1),
+				(Index >> ClusterShift) & (ClusterSize - 1),
+				Index >> (2 * ClusterShift)));
+		}
+	}
+}
+
+EVoxelGroundReachability FVoxelConnectivityGraph::SearchForGround(const FVoxelData& Data, const FVoxelConnectivityNode& StartNode, const FVoxelIslandDetectionSettings& Settings, TSet<FVoxelConnectivityNode>& Visited, int32& OutVoxelCount)
+{
+	// Best-first towards the ground: always expand the lowest cluster on the frontier
+	const auto LowerClusterFirst = [](const FVoxelConnectivityNode& A, const FVoxelConnectivityNode& B)
+	{
+		return A.Cluster.Z < B.Cluster.Z;
+	};
+
+	Frontier.Reset();
+	VisitedClusters.Reset();
+	Visited.Reset();
+	Visited.Add(StartNode);
+	VisitedClusters.Add(StartNode.Cluster);
+	Frontier.HeapPush(StartNode, LowerClusterFirst);
+	OutVoxelCount = 0;
+
+	while (Frontier.Num() > 0)
+	{
+		FVoxelConnectivityNode Node;
+		Frontier.HeapPop(Node, LowerClusterFirst, EAllowShrinking::No);
+		FCluster& Cluster = GetOrBuildCluster(Data, Node.Cluster);
+
+		if (Cluster.ComponentGrounded[Node.Component])
+		{
+			return EVoxelGroundReachability::Grounded;
+		}
+
+		OutVoxelCount += Cluster.ComponentSizes[Node.Component];
+		if (OutVoxelCount > Settings.MaxIslandVoxels)
+		{
+			return EVoxelGroundReachability::Unknown;
+		}
+
+		if (!Cluster.bLinksValid)
+		{
+			BuildLinks(Data, Node.Cluster, Cluster);
+		}
+
+		for (const FVoxelConnectivityNode& Link : Cluster.ComponentLinks[Node.Component])
+		{
+			if (Visited.Contains(Link))
+			{
+				continue;
+			}
+
+			Visited.Add(Link);
+			VisitedClusters.Add(Link.Cluster);
+			Frontier.HeapPush(Link, LowerClusterFirst);
+		}
+
+		if (VisitedClusters.Num() > MaxClustersPerSearch)
+		{
+			return EVoxelGroundReachability::Unknown;
+		}
+	}
+
+	return EVoxelGroundReachability::Floating;
+}
+
+TArray<FVoxelIsland> FVoxelConnectivityGraph::FindSeveredIslands(const FVoxelData& Data, const FIntVector& Min, const FIntVector& Max, const FVoxelIslandDetectionSettings& Settings)
+{
+	TArray<FVoxelIsland> Islands;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	if (Clusters.Num() > MaxCachedClusters)
+	{
+		UE_LOG(LogTemp, Log, TEXT("VoxelConnectivityGraph: Cache reached %d clusters, resetting"), Clusters.Num());
+		Reset();
+	}
+
+	// Component grounding is baked into each cluster, so a different anchor index invalidates them all
+	if (Settings.Anchors != Anchors)
+	{
+		Reset();
+		Anchors = Settings.Anchors;
+	}
+
+	const int32 NumCachedBefore = Clusters.Num();
+	QueryClusterMin = FIntVector(MAX_int32);
+	QueryClusterMax = FIntVector(MIN_int32);
+
+	// Components already proven grounded or floating during this query
+	Resolved.Reset();
+	int32 NumUnknown = 0;
+
+	const FIntVector ClusterMin = GetClusterCoord(Min);
+	const FIntVector ClusterMax = GetClusterCoord(Max);
+
+	for (int32 CZ = ClusterMin.Z; CZ <= ClusterMax.Z; CZ++)
+	{
+		for (int32 CY = ClusterMin.Y; CY <= ClusterMax.Y; CY++)
+		{
+			for (int32 CX = ClusterMin.X; CX <= ClusterMax.X; CX++)
+			{
+				const FIntVector StartCluster(CX, CY, CZ);
+				const int32 NumStartComponents = GetOrBuildCluster(Data, StartCluster).NumComponents();
+
+				for (int32 StartComponent = 0; StartComponent < NumStartComponents; StartComponent++)
+				{
+					const FVoxelConnectivityNode StartNode(StartCluster, StartComponent);
+					if (Resolved.Contains(StartNode))
+					{
+						continue;
+					}
+
+					int32 VoxelCount = 0;
+					const EVoxelGroundReachability Reachability = SearchForGround(Data, StartNode, Settings, SearchVisited, VoxelCount);
+					Resolved.Append(SearchVisited);
+
+					if (Reachability == EVoxelGroundReachability::Unknown)
+					{
+						NumUnknown++;
+					}
+
+					if (Reachability != EVoxelGroundReachability::Floating || VoxelCount < 5)
+					{
+						continue;
+					}
+
+					TArray<FIntVector> Voxels;
+					Voxels.Reserve(VoxelCount);
+					for (const FVoxelConnectivityNode& Node : SearchVisited)
+					{
+						GatherVoxels(Node, Voxels);
+					}
+
+					FVoxelIsland NewIsland;
+					NewIsland.Voxels.Assign(MoveTemp(Voxels));
+					NewIsland.UpdateStats();
+					NewIsland.bIsGrounded = false;
+
+					Islands.Add(MoveTemp(NewIsland));
+				}
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("VoxelConnectivityGraph: Found %d severed islands in %.2fms (%d undecided, %d clusters cached, %d built)"),
+		Islands.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0, NumUnknown, Clusters.Num(), FMath::Max(0, Clusters.Num() - NumCachedBefore));
+
+	return Islands;
+}
+
+void FVoxelConnectivityGraph::FindWeakClusters(const FVoxelData& Data, const FIntVector& ClusterMin, const FIntVector& ClusterMax, const FVoxelIslandDetectionSettings& Settings, TSet<FIntVector>& OutWeakClusters)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	OutWeakClusters.Reset();
+
+	if (Settings.Anchors != Anchors)
+	{
+		Reset();
+		Anchors = Settings.Anchors;
+	}
+
+	const auto IsInBox = [&](const FIntVector& ClusterCoord)
+	{
+		return ClusterCoord.X >= ClusterMin.X && ClusterCoord.X <= ClusterMax.X &&
+			ClusterCoord.Y >= ClusterMin.Y && ClusterCoord.Y <= ClusterMax.Y &&
+			ClusterCoord.Z >= ClusterMin.Z && ClusterCoord.Z <= ClusterMax.Z;
+	};
+
+	// Node 0 stands for every anchor, the others are the components in the box
+	TArray<FVoxelConnectivityNode> Nodes;
+	TMap<FVoxelConnectivityNode, int32> NodeIndices;
+	Nodes.AddDefaulted();
+
+	for (int32 CZ = ClusterMin.Z; CZ <= ClusterMax.Z; CZ++)
+	{
+		for (int32 CY = ClusterMin.Y; CY <= ClusterMax.Y; CY++)
+		{
+			for (int32 CX = ClusterMin.X; CX <= ClusterMax.X; CX++)
+			{
+				const FIntVector ClusterCoord(CX, CY, CZ);
+				FCluster& Cluster = GetOrBuildCluster(Data, ClusterCoord);
+				if (Cluster.NumComponents() > 0 && !Cluster.bLinksValid)
+				{
+					BuildLinks(Data, ClusterCoord, Cluster);
+				}
+
+				for (int32 Component = 0; Component < Cluster.NumComponents(); Component++)
+				{
+					const FVoxelConnectivityNode Node(ClusterCoord, Component);
+					NodeIndices.Add(Node, Nodes.Add(Node));
+				}
+			}
+		}
+	}
+
+	TArray<TArray<int32>> Edges;
+	Edges.SetNum(Nodes.Num());
+	for (int32 NodeIndex = 1; NodeIndex < Nodes.Num(); NodeIndex++)
+	{
+		const FVoxelConnectivityNode& Node = Nodes[NodeIndex];
+		const FCluster& Cluster = *Clusters.FindChecked(Node.Cluster);
+
+		if (Cluster.ComponentGrounded[Node.Component])
+		{
+			Edges[NodeIndex].Add(0);
+			Edges[0].Add(NodeIndex);
+		}
+
+		// Links are symmetric, so each side adds its own half
+		for (const FVoxelConnectivityNode& Link : Cluster.ComponentLinks[Node.Component])
+		{
+			if (IsInBox(Link.Cluster))
+			{
+				Edges[NodeIndex].Add(NodeIndices.FindChecked(Link));
+			}
+		}
+	}
+
+	// Iterative Tarjan from the anchor node: a node is an articulation point when some child cannot
+	// reach above it without it, and an edge is a bridge when the child cannot reach the parent at all
+	TArray<int32> Discovery;
+	TArray<int32> Low;
+	TArray<bool> bWeak;
+	TArray<bool> bArticulation;
+	Discovery.Init(INDEX_NONE, Nodes.Num());
+	Low.Init(0, Nodes.Num());
+	bWeak.Init(false, Nodes.Num());
+	bArticulation.Init(false, Nodes.Num());
+
+	struct FFrame
+	{
+		int32 Node;
+		int32 Parent;
+		int32 NextEdge;
+	};
+	TArray<FFrame> Stack;
+	Stack.Add({ 0, INDEX_NONE, 0 });
+	Discovery[0] = 0;
+	int32 Time = 1;
+	int32 NumBridges = 0;
+
+	while (Stack.Num() > 0)
+	{
+		const int32 FrameIndex = Stack.Num() - 1;
+		const int32 Node = Stack[FrameIndex].Node;
+
+		if (Stack[FrameIndex].NextEdge < Edges[Node].Num())
+		{
+			const int32 Next = Edges[Node][Stack[FrameIndex].NextEdge++];
+			if (Next == Stack[FrameIndex].Parent)
+			{
+				continue;
+			}
+
+			if (Discovery[Next] == INDEX_NONE)
+			{
+				Discovery[Next] = Low[Next] = Time++;
+				Stack.Add({ Next, Node, 0 });
+			}
+			else
+			{
+				Low[Node] = FMath::Min(Low[Node], Discovery[Next]);
+			}
+			continue;
+		}
+
+		const int32 Parent = Stack[FrameIndex].Parent;
+		Stack.Pop(EAllowShrinking::No);
+		if (Parent == INDEX_NONE)
+		{
+			continue;
+		}
+
+		Low[Parent] = FMath::Min(Low[Parent], Low[Node]);
+		if (Low[Node] > Discovery[Parent])
+		{
+			NumBridges++;
+			bWeak[Node] = true;
+			bWeak[Parent] = true;
+		}
+		if (Parent != 0 && Low[Node] >= Discovery[Parent])
+		{
+			bArticulation[Parent] = true;
+			bWeak[Parent] = true;
+		}
+	}
+
+	int32 NumArticulations = 0;
+	for (int32 NodeIndex = 1; NodeIndex < Nodes.Num(); NodeIndex++)
+	{
+		const FVoxelConnectivityNode& Node = Nodes[NodeIndex];
+		NumArticulations += bArticulation[NodeIndex] ? 1 : 0;
+
+		// Thin components can be cut through inside their own cluster, which the graph does not see.
+		// Anchored ones are exempt so thin ground layers stay cheap to dig; this is a prediction at cluster
+		// granularity, and a small overhang cut loose inside one anchored cluster is not caught.
+		const FCluster& Cluster = *Clusters.FindChecked(Node.Cluster);
+		const bool bThin = !Cluster.ComponentGrounded[Node.Component] && Cluster.ComponentSizes[Node.Component] < MinBulkComponentVoxels;
+		if (bWeak[NodeIndex] || bThin || Discovery[NodeIndex] == INDEX_NONE)
+		{
+			OutWeakClusters.Add(Node.Cluster);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("VoxelConnectivityGraph: Bridge analysis of %d components took %.2fms (%d articulation points, %d bridges, %d weak clusters)"),
+		Nodes.Num() - 1, (FPlatformTime::Seconds() - StartTime) * 1000.0, NumArticulations, NumBridges, OutWeakClusters.Num());
+}
+
+bool FVoxelBridgeRegions::MaySever(const FIntVector& VoxelMin, const FIntVector& VoxelMax) const
+{
+	if (!bValid)
+	{
+		return true;
+	}
+
+	auto IsInAnalysedBox = [&](const FIntVector& Cluster)
+	{
+		return Cluster.X >= ClusterMin.X && Cluster.X <= ClusterMax.X &&
+			Cluster.Y >= ClusterMin.Y && Cluster.Y <= ClusterMax.Y &&
+			Cluster.Z >= ClusterMin.Z && Cluster.Z <= ClusterMax.Z;
+	};
+
+	const FIntVector DigMin = FVoxelConnectivityGraph::GetClusterCoord(VoxelMin);
+	const FIntVector DigMax = FVoxelConnectivityGraph::GetClusterCoord(VoxelMax);
+	for (int32 Z = DigMin.Z; Z <= DigMax.Z; Z++)
+	{
+		for (int32 Y = DigMin.Y; Y <= DigMax.Y; Y++)
+		{
+			for (int32 X = DigMin.X; X <= DigMax.X; X++)
+			{
+				const FIntVector Cluster(X, Y, Z);
+				if (!IsInAnalysedBox(Cluster) || WeakClusters.Contains(Cluster))
+				{
+					return true;
+				}
+			}
+		}
+	}
+
+	// An earlier edit in the box may have made any of its clusters a bridge
+	if (InFlightDirtyClusters.Num() > 0)
+	{
+		return true;
+	}
+	for (const FIntVector& Cluster : DirtyClusters)
+	{
+		if (IsInAnalysedBox(Cluster))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FVoxelBridgeRegions::MarkDirty(const FIntVector& VoxelMin, const FIntVector& VoxelMax)
+{
+	const FIntVector DirtyMin = FVoxelConnectivityGraph::GetClusterCoord(VoxelMin);
+	const FIntVector DirtyMax = FVoxelConnectivityGraph::GetClusterCoord(VoxelMax);
+	for (int32 Z = DirtyMin.Z; Z <= DirtyMax.Z; Z++)
+	{
+		for (int32 Y = DirtyMin.Y; Y <= DirtyMax.Y; Y++)
+		{
+			for (int32 X = DirtyMin.X; X <= DirtyMax.X; X++)
+			{
+				DirtyClusters.Add(FIntVector(X, Y, Z));
+			}
+		}
+	}
+}
+
+void FVoxelBridgeRegions::BeginAnalysis()
+{
+	InFlightDirtyClusters = MoveTemp(DirtyClusters);
+	DirtyClusters.Reset();
+	bAnalysisInFlight = true;
+}
+
+void FVoxelBridgeRegions::FinishAnalysis(const FIntVector& InClusterMin, const FIntVector& InClusterMax, TSet<FIntVector>&& InWeakClusters)
+{
+	bValid = true;
+	ClusterMin = InClusterMin;
+	ClusterMax = InClusterMax;
+	WeakClusters = MoveTemp(InWeakClusters);
+	InFlightDirtyClusters.Reset();
+	bAnalysisInFlight = false;
+}
@@ -0,0 +1,176 @@
+// VoxelConnectivityGraph.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelIslandDetection.h"
+#include "VoxelOccupancyBuffer.h"
+
+class FVoxelData;
+struct FVoxelIsland;
+class FVoxelOccupancyPyramid;
+
+// One solid component inside one cluster
+struct FVoxelConnectivityNode
+{
+	FIntVector Cluster = FIntVector::ZeroValue;
+	int32 Component = 0;
+
+	FVoxelConnectivityNode() = default;
+	FVoxelConnectivityNode(const FIntVector& InCluster, int32 InComponent)
+		: Cluster(InCluster)
+		, Component(InComponent)
+	{
+	}
+
+	bool operator==(const FVoxelConnectivityNode& Other) const
+	{
+		return Cluster == Other.Cluster && Component == Other.Component;
+	}
+
+	friend uint32 GetTypeHash(const FVoxelConnectivityNode& Node)
+	{
+		return HashCombine(GetTypeHash(Node.Cluster), ::GetTypeHash(Node.Component));
+	}
+};
+
+/**
+ * Persistent cluster-level connectivity graph for one voxel world.
+ * Space is split into 16^3 clusters (same resolution as the detection clustering). Each cluster stores its
+ * 6-connected solid components, and components of face-adjacent clusters are linked where solid voxels touch.
+ * Clusters are built lazily from voxel data and only rebuilt after an edit invalidates them, so a severance
+ * check after a dig is a local rebuild plus a graph search instead of a full rescan.
+ */
+class FVoxelConnectivityGraph
+{
+public:
+	static constexpr int32 ClusterShift = 4;
+	static constexpr int32 ClusterSize = 1 << ClusterShift;
+	static constexpr int32 VoxelsPerCluster = ClusterSize * ClusterSize * ClusterSize;
+
+	// Upper bound on clusters visited by one ground search - beyond this the structure is treated as terrain
+	static constexpr int32 MaxClustersPerSearch = 1024;
+
+	// Cache is dropped when it grows past this (8 KB of labels per cluster)
+	static constexpr int32 MaxCachedClusters = 4096;
+
+	// Components smaller than this are treated as thin (ledges, beams) by FindWeakClusters
+	static constexpr int32 MinBulkComponentVoxels = VoxelsPerCluster / 4;
+
+	// Invalidated clusters kept for rebuilding, so digging does not reallocate label arrays
+	static constexpr int32 MaxFreeClusters = 64;
+
+	// Drops every cluster overlapping the inclusive voxel box plus the links of their neighbors
+	void Invalidate(const FIntVector& Min, const FIntVector& Max);
+
+	void Reset();
+
+	// Finds components touching the inclusive voxel box that no longer reach an anchor (Settings.Anchors).
+	// Searches that exceed MaxIslandVoxels or MaxClustersPerSearch are undecided and left in place.
+	TArray<FVoxelIsland> FindSeveredIslands(const FVoxelData& Data, const FIntVector& Min, const FIntVector& Max, const FVoxelIslandDetectionSettings& Settings);
+
+	// Finds the clusters in the inclusive cluster box where a dig could split a structure: components that
+	// are articulation points or end a bridge of the component graph (anchors form one extra node), thin
+	// components, and components that do not reach an anchor inside the box. Links leaving the box are
+	// ignored, which can only add weak clusters. A single dig that only touches other clusters removes bulk
+	// material that every structure can route around, so it cannot sever anything at cluster granularity -
+	// but only against an analysis of the current data, see FVoxelBridgeRegions.
+	void FindWeakClusters(const FVoxelData& Data, const FIntVector& ClusterMin, const FIntVector& ClusterMax, const FVoxelIslandDetectionSettings& Settings, TSet<FIntVector>& OutWeakClusters);
+
+	int32 GetNumCachedClusters() const { return Clusters.Num(); }
+
+	// Inclusive cluster box of every cluster the last FindSeveredIslands touched, i.e. what its answer depends on
+	void GetLastQueryClusters(FIntVector& OutClusterMin, FIntVector& OutClusterMax) const
+	{
+		OutClusterMin = QueryClusterMin;
+		OutClusterMax = QueryClusterMax;
+	}
+
+	// Clusters the pyramid knows to be empty or full are built without reading voxel data, and clusters
+	// that are read are recorded in it. Clusters match pyramid cells. Must outlive the graph.
+	void SetOccupancyPyramid(FVoxelOccupancyPyramid* InPyramid) { Pyramid = InPyramid; }
+
+	static FORCEINLINE FIntVector GetClusterCoord(const FIntVector& Voxel)
+	{
+		return FIntVector(Voxel.X >> ClusterShift, Voxel.Y >> ClusterShift, Voxel.Z >> ClusterShift);
+	}
+
+private:
+	struct FCluster
+	{
+		// Per-voxel component label, 0 = empty, X fastest
+		TArray<uint16> Labels;
+		TArray<int32> ComponentSizes;
+		TArray<bool> ComponentGrounded;
+
+		// Components of neighbor clusters each component touches, built on first traversal
+		TArray<TArray<FVoxelConnectivityNode>> ComponentLinks;
+		bool bLinksValid = false;
+
+		int32 NumComponents() const { return ComponentSizes.Num(); }
+	};
+
+	static FORCEINLINE int32 LocalIndex(int32 X, int32 Y, int32 Z)
+	{
+		return X + ClusterSize * (Y + ClusterSize * Z);
+	}
+
+	FCluster& GetOrBuildCluster(const FVoxelData& Data, const FIntVector& ClusterCoord);
+	void BuildCluster(const FVoxelData& Data, const FIntVector& ClusterCoord, FCluster& Cluster);
+	void RecycleCluster(TUniquePtr<FCluster> Cluster);
+	void BuildLinks(const FVoxelData& Data, const FIntVector& ClusterCoord, FCluster& Cluster);
+	void GatherVoxels(const FVoxelConnectivityNode& Node, TArray<FIntVector>& OutVoxels) const;
+
+	// Best-first search from StartNode towards the lowest clusters. Visited receives every node reached.
+	EVoxelGroundReachability SearchForGround(const FVoxelData& Data, const FVoxelConnectivityNode& StartNode, const FVoxelIslandDetectionSettings& Settings, TSet<FVoxelConnectivityNode>& Visited, int32& OutVoxelCount);
+
+	// Pointers stay valid while neighbors are built during a search
+	TMap<FIntVector, TUniquePtr<FCluster>> Clusters;
+
+	// Anchors the cached clusters were grounded against
+	TSharedPtr<const FVoxelGroundAnchorIndex> Anchors;
+
+	FVoxelOccupancyPyramid* Pyramid = nullptr;
+
+	FIntVector QueryClusterMin = FIntVector(MAX_int32);
+	FIntVector QueryClusterMax = FIntVector(MIN_int32);
+
+	TArray<TUniquePtr<FCluster>> FreeClusters;
+
+	// Query and build temporaries, reset between uses so their memory is reused
+	TSet<FVoxelConnectivityNode> Resolved;
+	TSet<FVoxelConnectivityNode> SearchVisited;
+	TArray<FVoxelConnectivityNode> Frontier;
+	TSet<FIntVector> VisitedClusters;
+	FVoxelOccupancyBuffer BuildOccupancy;
+	TArray<bool> BuildSolid;
+	TArray<int32> BuildStack;
+};
+
+/**
+ * Weak links found by the last FindWeakClusters run over one world, and the clusters edited since.
+ * A dig that touches no weak cluster cannot sever anything, but the dig itself can turn other clusters
+ * of the analysed box into bridges (the second of two pillars holding up a slab). So once anything in
+ * the box was edited since the analysis started, every dig in the box may sever until the next lands.
+ */
+struct FVoxelBridgeRegions
+{
+	bool bValid = false;
+	FIntVector ClusterMin = FIntVector::ZeroValue;
+	FIntVector ClusterMax = FIntVector::ZeroValue;
+	TSet<FIntVector> WeakClusters;
+
+	// Edited since the last analysis started, or while it ran - unknown until the next one
+	TSet<FIntVector> DirtyClusters;
+	TSet<FIntVector> InFlightDirtyClusters;
+
+	bool bAnalysisInFlight = false;
+
+	// Whether a dig over the inclusive voxel box may split a structure. Call before MarkDirty for that dig.
+	bool MaySever(const FIntVector& VoxelMin, const FIntVector& VoxelMax) const;
+
+	void MarkDirty(const FIntVector& VoxelMin, const FIntVector& VoxelMax);
+
+	// Edits from now on may not be seen by the analysis, so they stay dirty after it lands
+	void BeginAnalysis();
+	void FinishAnalysis(const FIntVector& InClusterMin, const FIntVector& InClusterMax, TSet<FIntVector>&& InWeakClusters);
+};
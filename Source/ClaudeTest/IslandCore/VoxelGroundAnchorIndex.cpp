@@ -0,0 +1,44 @@
+// VoxelGroundAnchorIndex.cpp
+#include "VoxelGroundAnchorIndex.h"
+#include <atomic>
+
+FVoxelGroundAnchorIndex::FVoxelGroundAnchorIndex()
+{
+	static std::atomic<uint32> NextGeneration(1);
+	Generation = NextGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FVoxelGroundAnchorIndex::SetHeightfield(const FIntVector& InOrigin, int32 InCellSize, int32 InCountX, int32 InCountY, TArray<int32> InHeights)
+{
+	if (InCountX <= 0 || InCountY <= 0 || InHeights.Num() != InCountX * InCountY)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("VoxelGroundAnchorIndex: Ignoring heightfield with %d heights for %dx%d cells"), InHeights.Num(), InCountX, InCountY);
+		Heights.Reset();
+		return;
+	}
+
+	HeightOrigin = InOrigin;
+	HeightCellSize = FMath::Max(1, InCellSize);
+	HeightCountX = InCountX;
+	HeightCountY = InCountY;
+	Heights = MoveTemp(InHeights);
+}
+
+void FVoxelGroundAnchorIndex::AddAnchorBox(const FIntVector& Min, const FIntVector& Max)
+{
+	const int32 BoxIndex = Boxes.Add({ Min, Max });
+
+	const FIntVector CellMin(Min.X >> BoxCellShift, Min.Y >> BoxCellShift, Min.Z >> BoxCellShift);
+	const FIntVector CellMax(Max.X >> BoxCellShift, Max.Y >> BoxCellShift, Max.Z >> BoxCellShift);
+
+	for (int32 Z = CellMin.Z; Z <= CellMax.Z; Z++)
+	{
+		for (int32 Y = CellMin.Y; Y <= CellMax.Y; Y++)
+		{
+			for (int32 X = CellMin.X; X <= CellMax.X; X++)
+			{
+				BoxesByCell.FindOrAdd(FIntVector(X, Y, Z)).Add(BoxIndex);
+			}
+		}
+	}
+}
@@ -0,0 +1,102 @@
+// VoxelGroundAnchorIndex.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Answers "is this voxel anchored to the world" for island grounding checks.
+ * Three sources are combined: a flat ground level (the old Z <= 0 rule), a heightfield of bedrock
+ * heights, and explicit anchor boxes such as indestructible pillars. All positions are in the voxel
+ * space of one world. The index is immutable once built and shared with worker threads.
+ */
+class FVoxelGroundAnchorIndex
+{
+public:
+	// Boxes are bucketed by cell so a lookup only tests the few boxes near the voxel
+	static constexpr int32 BoxCellShift = 4;
+
+	FVoxelGroundAnchorIndex();
+
+	// Unique per index ever built, so caches keyed on it never confuse a rebuild with a freed index
+	// that happened to live at the same address
+	uint32 GetGeneration() const { return Generation; }
+
+	void SetGroundLevel(int32 InGroundLevel)
+	{
+		GroundLevel = InGroundLevel;
+	}
+
+	int32 GetGroundLevel() const { return GroundLevel; }
+
+	// Every voxel at or below Heights[X + Y * Count.X] in that column cell is anchored
+	void SetHeightfield(const FIntVector& InOrigin, int32 InCellSize, int32 InCountX, int32 InCountY, TArray<int32> InHeights);
+
+	// Inclusive voxel box that is always anchored
+	void AddAnchorBox(const FIntVector& Min, const FIntVector& Max);
+
+	// True when only the flat ground level is set, so callers can use plane tests
+	bool IsGroundLevelOnly() const
+	{
+		return Heights.Num() == 0 && Boxes.Num() == 0;
+	}
+
+	int32 GetNumAnchorBoxes() const { return Boxes.Num(); }
+
+	FORCEINLINE bool IsAnchor(const FIntVector& Pos) const
+	{
+		if (Pos.Z <= GroundLevel)
+		{
+			return true;
+		}
+
+		if (Heights.Num() > 0)
+		{
+			const int32 CellX = FMath::DivideAndRoundDown(Pos.X - HeightOrigin.X, HeightCellSize);
+			const int32 CellY = FMath::DivideAndRoundDown(Pos.Y - HeightOrigin.Y, HeightCellSize);
+			if (CellX >= 0 && CellX < HeightCountX && CellY >= 0 && CellY < HeightCountY &&
+				Pos.Z <= Heights[CellX + CellY * HeightCountX])
+			{
+				return true;
+			}
+		}
+
+		if (Boxes.Num() > 0)
+		{
+			const FIntVector Cell(Pos.X >> BoxCellShift, Pos.Y >> BoxCellShift, Pos.Z >> BoxCellShift);
+			if (const TArray<int32>* CellBoxes = BoxesByCell.Find(Cell))
+			{
+				for (const int32 BoxIndex : *CellBoxes)
+				{
+					const FBox3i& Box = Boxes[BoxIndex];
+					if (Pos.X >= Box.Min.X && Pos.X <= Box.Max.X &&
+						Pos.Y >= Box.Min.Y && Pos.Y <= Box.Max.Y &&
+						Pos.Z >= Box.Min.Z && Pos.Z <= Box.Max.Z)
+					{
+						return true;
+					}
+				}
+			}
+		}
+
+		return false;
+	}
+
+private:
+	struct FBox3i
+	{
+		FIntVector Min;
+		FIntVector Max;
+	};
+
+	uint32 Generation = 0;
+	int32 GroundLevel = 0;
+
+	FIntVector HeightOrigin = FIntVector::ZeroValue;
+	int32 HeightCellSize = 1;
+	int32 HeightCountX = 0;
+	int32 HeightCountY = 0;
+	TArray<int32> Heights;
+
+	TArray<FBox3i> Boxes;
+	TMap<FIntVector, TArray<int32>> BoxesByCell;
+};
@@ -0,0 +1,32 @@
+// VoxelIsland.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelIslandVoxels.h"
+
+// One connected piece found by island detection
+struct FVoxelIsland
+{
+	// Brick-packed voxel set - iterate with for (const FIntVector Pos : Island.Voxels)
+	FVoxelIslandVoxels Voxels;
+	FIntVector MinBounds = FIntVector::ZeroValue;
+	FIntVector MaxBounds = FIntVector::ZeroValue;
+	FVector CenterOfMass = FVector::ZeroVector;
+	bool bIsGrounded = false;
+
+	// Voxel-unit inertia about CenterOfMass, see FVoxelIslandStats
+	FVector InertiaDiagonal = FVector::ZeroVector;
+	FVector InertiaProducts = FVector::ZeroVector;
+
+	// Fills bounds, center of mass and inertia from Voxels in a single pass, so later stages read them
+	// from here instead of walking the voxels again
+	void UpdateStats()
+	{
+		const FVoxelIslandStats Stats = Voxels.ComputeStats();
+		MinBounds = Stats.Min;
+		MaxBounds = Stats.Max;
+		CenterOfMass = Stats.Centroid;
+		InertiaDiagonal = Stats.InertiaDiagonal;
+		InertiaProducts = Stats.InertiaProducts;
+	}
+};
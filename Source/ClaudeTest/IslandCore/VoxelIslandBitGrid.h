@@ -0,0 +1,144 @@
+// VoxelIslandBitGrid.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Dense bit grid covering a fixed voxel box, used by island detection instead of TSet<FIntVector>.
+ * Bits are grouped into 8x8x8 bricks of eight 64-bit words (one word per Z slice, bit = Y * 8 + X)
+ * so neighboring voxels share cache lines and a lookup is a shift and a mask instead of a hash.
+ */
+struct FVoxelIslandBitGrid
+{
+	static constexpr int32 BrickSize = 8;
+	static constexpr int32 WordsPerBrick = 8;
+
+	FVoxelIslandBitGrid() = default;
+
+	// Min and Max are inclusive, matching the SearchMin/SearchMax convention of DetectIslands
+	FVoxelIslandBitGrid(const FIntVector& InMin, const FIntVector& InMax)
+	{
+		Init(InMin, InMax);
+	}
+
+	void Init(const FIntVector& InMin, const FIntVector& InMax)
+	{
+		Min = InMin;
+		Max = InMax;
+
+		const FIntVector Size = InMax - InMin + FIntVector(1);
+		NumBricks = FIntVector(
+			FMath::DivideAndRoundUp(Size.X, BrickSize),
+			FMath::DivideAndRoundUp(Size.Y, BrickSize),
+			FMath::DivideAndRoundUp(Size.Z, BrickSize));
+
+		Words.Reset();
+		Words.SetNumZeroed(NumBricks.X * NumBricks.Y * NumBricks.Z * WordsPerBrick);
+	}
+
+	void Reset()
+	{
+		FMemory::Memzero(Words.GetData(), Words.Num() * sizeof(uint64));
+	}
+
+	// Sets every bit inside the box. Boxes made of whole bricks have no padding bits and are filled per word.
+	void SetAll()
+	{
+		const FIntVector Size = Max - Min + FIntVector(1);
+		if (Size.X % BrickSize == 0 && Size.Y % BrickSize == 0 && Size.Z % BrickSize == 0)
+		{
+			FMemory::Memset(Words.GetData(), 0xFF, Words.Num() * sizeof(uint64));
+			return;
+		}
+
+		for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+		{
+			for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+			{
+				for (int32 X = Min.X; X <= Max.X; X++)
+				{
+					Set(FIntVector(X, Y, Z));
+				}
+			}
+		}
+	}
+
+	FORCEINLINE bool Contains(const FIntVector& Pos) const
+	{
+		return Pos.X >= Min.X && Pos.X <= Max.X &&
+			Pos.Y >= Min.Y && Pos.Y <= Max.Y &&
+			Pos.Z >= Min.Z && Pos.Z <= Max.Z;
+	}
+
+	// Position must be inside the grid - callers check Contains() first
+	FORCEINLINE bool Get(const FIntVector& Pos) const
+	{
+		int32 WordIndex;
+		uint64 Mask;
+		Locate(Pos, WordIndex, Mask);
+		return (Words[WordIndex] & Mask) != 0;
+	}
+
+	FORCEINLINE void Set(const FIntVector& Pos)
+	{
+		int32 WordIndex;
+		uint64 Mask;
+		Locate(Pos, WordIndex, Mask);
+		Words[WordIndex] |= Mask;
+	}
+
+	// Sets the bit and returns whether it was already set
+	FORCEINLINE bool TestAndSet(const FIntVector& Pos)
+	{
+		int32 WordIndex;
+		uint64 Mask;
+		Locate(Pos, WordIndex, Mask);
+		const bool bWasSet = (Words[WordIndex] & Mask) != 0;
+		Words[WordIndex] |= Mask;
+		return bWasSet;
+	}
+
+	// TestAndSet for grids claimed by several threads at once. Other bits of the grid must only be
+	// changed through this call while threads share it.
+	FORCEINLINE bool AtomicTestAndSet(const FIntVector& Pos)
+	{
+		int32 WordIndex;
+		uint64 Mask;
+		Locate(Pos, WordIndex, Mask);
+		const int64 OldWord = FPlatformAtomics::InterlockedOr(reinterpret_cast<volatile int64*>(&Words[WordIndex]), int64(Mask));
+		return (uint64(OldWord) & Mask) != 0;
+	}
+
+	// Padding bits past the box are never set, so every word can be counted as is
+	int64 CountSet() const
+	{
+		int64 Count = 0;
+		for (const uint64 Word : Words)
+		{
+			Count += FMath::CountBits(Word);
+		}
+		return Count;
+	}
+
+	int64 GetAllocatedSize() const
+	{
+		return Words.GetAllocatedSize();
+	}
+
+	FIntVector Min = FIntVector::ZeroValue;
+	FIntVector Max = FIntVector(-1);
+	FIntVector NumBricks = FIntVector::ZeroValue;
+	TArray<uint64> Words;
+
+private:
+	FORCEINLINE void Locate(const FIntVector& Pos, int32& OutWordIndex, uint64& OutMask) const
+	{
+		const int32 LX = Pos.X - Min.X;
+		const int32 LY = Pos.Y - Min.Y;
+		const int32 LZ = Pos.Z - Min.Z;
+
+		const int32 BrickIndex = (LX >> 3) + NumBricks.X * ((LY >> 3) + NumBricks.Y * (LZ >> 3));
+		OutWordIndex = BrickIndex * WordsPerBrick + (LZ & 7);
+		OutMask = uint64(1) << ((LY & 7) * BrickSize + (LX & 7));
+	}
+};
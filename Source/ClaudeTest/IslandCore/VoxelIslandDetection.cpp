@@ -0,0 +1,1209 @@
+// VoxelIslandDetection.cpp
+#include "VoxelIslandDetection.h"
+#include "VoxelIsland.h"
+#include "VoxelBrickLabeling.h"
+#include "VoxelOccupancyBuffer.h"
+#include "VoxelOccupancyPyramid.h"
+#include "VoxelData/VoxelData.h"
+#include "VoxelData/VoxelDataIncludes.h"
+#include "VoxelIntBox.h"
+#include "Async/ParallelFor.h"
+#include <atomic>
+
+// Occupancy sources the detection kernel is instantiated for. Both expose the same queries so the
+// flood fill compiles to direct calls with no virtual dispatch per voxel.
+
+// Reads voxel data lazily in bulk, one data chunk at a time - the caller holds a read lock covering
+// every chunk the floods can reach (see GetChunkAlignedLockBounds). Chunk buffers come from a pool
+// that outlives the detection, so their arrays are reused by the next one. Chunks the occupancy pyramid
+// already knows to be empty or full are filled without reading, and every chunk read is recorded in it.
+struct FVoxelLiveOccupancy
+{
+	static constexpr int32 ChunkShift = 4;
+	static constexpr int32 ChunkSize = 1 << ChunkShift;
+	static_assert(ChunkShift == FVoxelOccupancyPyramid::CellShift, "Chunks must map to pyramid cells");
+
+	const FVoxelData& Data;
+	FVoxelOccupancyPyramid* Pyramid;
+
+	// Chunk -> index into ChunkPool. Only the first ChunkIndex.Num() pool entries are in use.
+	TMap<FIntVector, int32>& ChunkIndex;
+	TArray<TUniquePtr<FVoxelOccupancyBuffer>>& ChunkPool;
+
+	mutable FIntVector LastChunkCoord = FIntVector(MAX_int32);
+	mutable const FVoxelOccupancyBuffer* LastChunk = nullptr;
+
+	// Chunks answered by the pyramid instead of a data read
+	mutable int32 NumSkippedReads = 0;
+
+	FVoxelLiveOccupancy(const FVoxelData& InData, FVoxelOccupancyPyramid* InPyramid, TMap<FIntVector, int32>& InChunkIndex, TArray<TUniquePtr<FVoxelOccupancyBuffer>>& InChunkPool)
+		: Data(InData)
+		, Pyramid(InPyramid)
+		, ChunkIndex(InChunkIndex)
+		, ChunkPool(InChunkPool)
+	{
+		ChunkIndex.Reset();
+	}
+
+	FORCEINLINE bool IsSolid(const FIntVector& Pos) const
+	{
+		const FIntVector ChunkCoord(Pos.X >> ChunkShift, Pos.Y >> ChunkShift, Pos.Z >> ChunkShift);
+		if (ChunkCoord != LastChunkCoord)
+		{
+			LastChunk = &GetChunk(ChunkCoord);
+			LastChunkCoord = ChunkCoord;
+		}
+		return LastChunk->IsSolid(Pos);
+	}
+
+	// Outside the search box - still readable, the lock covers a chunk of margin
+	FORCEINLINE bool IsSolidOrUnknown(const FIntVector& Pos) const
+	{
+		return IsSolid(Pos);
+	}
+
+	const FVoxelOccupancyBuffer& GetChunk(const FIntVector& ChunkCoord) const
+	{
+		if (const int32* Existing = ChunkIndex.Find(ChunkCoord))
+		{
+			return *ChunkPool[*Existing];
+		}
+
+		const int32 PoolIndex = ChunkIndex.Num();
+		if (PoolIndex == ChunkPool.Num())
+		{
+			ChunkPool.Add(MakeUnique<FVoxelOccupancyBuffer>());
+		}
+		ChunkIndex.Add(ChunkCoord, PoolIndex);
+
+		FVoxelOccupancyBuffer& Chunk = *ChunkPool[PoolIndex];
+		const FIntVector ChunkMin = ChunkCoord * ChunkSize;
+		const FIntVector ChunkMax = ChunkMin + FIntVector(ChunkSize - 1);
+
+		const EVoxelOccupancyState State = Pyramid ? Pyramid->GetCellState(ChunkCoord) : EVoxelOccupancyState::Unknown;
+		if (State == EVoxelOccupancyState::Empty || State == EVoxelOccupancyState::Full)
+		{
+			Chunk.Fill(ChunkMin, ChunkMax, State == EVoxelOccupancyState::Full);
+			NumSkippedReads++;
+			return Chunk;
+		}
+
+		Chunk.ReadLocked(Data, ChunkMin, ChunkMax);
+		if (Pyramid)
+		{
+			Pyramid->SetCellFromGrid(ChunkCoord, Chunk.Solid);
+		}
+		return Chunk;
+	}
+
+	// Search box grown to whole chunks plus one chunk of margin for the out-of-box probes
+	static FVoxelIntBox GetChunkAlignedLockBounds(const FIntVector& SearchMin, const FIntVector& SearchMax)
+	{
+		const FIntVector ChunkMin(SearchMin.X >> ChunkShift, SearchMin.Y >> ChunkShift, SearchMin.Z >> ChunkShift);
+		const FIntVector ChunkMax(SearchMax.X >> ChunkShift, SearchMax.Y >> ChunkShift, SearchMax.Z >> ChunkShift);
+		return FVoxelIntBox((ChunkMin - FIntVector(1)) * ChunkSize, (ChunkMax + FIntVector(2)) * ChunkSize);
+	}
+};
+
+// Reads from an occupancy snapshot - safe on any thread, no lock needed
+struct FVoxelSnapshotOccupancy
+{
+	const FVoxelIslandBitGrid& Solid;
+
+	FORCEINLINE bool IsSolid(const FIntVector& Pos) const
+	{
+		return Solid.Get(Pos);
+	}
+
+	// Nothing is known past the snapshot, so assume solid
+	FORCEINLINE bool IsSolidOrUnknown(const FIntVector& Pos) const
+	{
+		return true;
+	}
+};
+
+// Neighbor offsets of each connectivity rule. They are compile-time constants, so a flood instantiated
+// for one rule visits its neighbors with unrolled code and no per-voxel dispatch.
+template<EVoxelConnectivity Connectivity>
+struct TVoxelNeighborhood;
+
+template<>
+struct TVoxelNeighborhood<EVoxelConnectivity::Faces6>
+{
+	static constexpr int32 Num = 6;
+	static constexpr int32 Offsets[Num][3] = {
+		{ 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 }
+	};
+};
+
+template<>
+struct TVoxelNeighborhood<EVoxelConnectivity::Edges18>
+{
+	static constexpr int32 Num = 18;
+	static constexpr int32 Offsets[Num][3] = {
+		{ 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 },
+		{ 1, 1, 0 }, { 1, -1, 0 }, { -1, 1, 0 }, { -1, -1, 0 },
+		{ 1, 0, 1 }, { 1, 0, -1 }, { -1, 0, 1 }, { -1, 0, -1 },
+		{ 0, 1, 1 }, { 0, 1, -1 }, { 0, -1, 1 }, { 0, -1, -1 }
+	};
+};
+
+template<>
+struct TVoxelNeighborhood<EVoxelConnectivity::Corners26>
+{
+	static constexpr int32 Num = 26;
+	static constexpr int32 Offsets[Num][3] = {
+		{ 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 },
+		{ 1, 1, 0 }, { 1, -1, 0 }, { -1, 1, 0 }, { -1, -1, 0 },
+		{ 1, 0, 1 }, { 1, 0, -1 }, { -1, 0, 1 }, { -1, 0, -1 },
+		{ 0, 1, 1 }, { 0, 1, -1 }, { 0, -1, 1 }, { 0, -1, -1 },
+		{ 1, 1, 1 }, { 1, 1, -1 }, { 1, -1, 1 }, { 1, -1, -1 },
+		{ -1, 1, 1 }, { -1, 1, -1 }, { -1, -1, 1 }, { -1, -1, -1 }
+	};
+};
+
+template<EVoxelConnectivity Connectivity, typename TVisit, uint32... Indices>
+static FORCEINLINE void ForEachNeighborImpl(const FIntVector& Pos, TVisit& Visit, TIntegerSequence<uint32, Indices...>)
+{
+	using FNeighborhood = TVoxelNeighborhood<Connectivity>;
+	(Visit(Pos + FIntVector(FNeighborhood::Offsets[Indices][0], FNeighborhood::Offsets[Indices][1], FNeighborhood::Offsets[Indices][2])), ...);
+}
+
+template<EVoxelConnectivity Connectivity, typename TPredicate, uint32... Indices>
+static FORCEINLINE bool AnyNeighborImpl(const FIntVector& Pos, TPredicate& Predicate, TIntegerSequence<uint32, Indices...>)
+{
+	using FNeighborhood = TVoxelNeighborhood<Connectivity>;
+	return (Predicate(Pos + FIntVector(FNeighborhood::Offsets[Indices][0], FNeighborhood::Offsets[Indices][1], FNeighborhood::Offsets[Indices][2])) || ...);
+}
+
+template<EVoxelConnectivity Connectivity, typename TVisit>
+static FORCEINLINE void ForEachNeighbor(const FIntVector& Pos, TVisit&& Visit)
+{
+	ForEachNeighborImpl<Connectivity>(Pos, Visit, TMakeIntegerSequence<uint32, TVoxelNeighborhood<Connectivity>::Num>());
+}
+
+// Stops at the first neighbor the predicate accepts
+template<EVoxelConnectivity Connectivity, typename TPredicate>
+static FORCEINLINE bool AnyNeighbor(const FIntVector& Pos, TPredicate&& Predicate)
+{
+	return AnyNeighborImpl<Connectivity>(Pos, Predicate, TMakeIntegerSequence<uint32, TVoxelNeighborhood<Connectivity>::Num>());
+}
+
+// Turns a runtime connectivity into a compile-time one. Called once per detection step, not per voxel.
+template<typename TFunction>
+static FORCEINLINE decltype(auto) DispatchConnectivity(EVoxelConnectivity Connectivity, TFunction&& Function)
+{
+	switch (Connectivity)
+	{
+	case EVoxelConnectivity::Edges18:
+		return Function(TIntegralConstant<EVoxelConnectivity, EVoxelConnectivity::Edges18>());
+	case EVoxelConnectivity::Corners26:
+		return Function(TIntegralConstant<EVoxelConnectivity, EVoxelConnectivity::Corners26>());
+	default:
+		return Function(TIntegralConstant<EVoxelConnectivity, EVoxelConnectivity::Faces6>());
+	}
+}
+
+// Packs a detached set of voxels and fills its statistics
+static FVoxelIsland MakeFloatingIsland(TArray<FIntVector> Voxels)
+{
+	FVoxelIsland NewIsland;
+	NewIsland.Voxels.Assign(MoveTemp(Voxels));
+	NewIsland.UpdateStats();
+	NewIsland.bIsGrounded = false;
+	return NewIsland;
+}
+
+// Calls Visit for every voxel outside the carved spheres with a neighbor (under Connectivity) inside one
+// of them. Voxels between two overlapping spheres can be visited once per sphere.
+template<EVoxelConnectivity Connectivity, typename TVisit>
+static void ForEachShellVoxel(const FVoxelIslandEditShape& Shape, TVisit&& Visit)
+{
+	for (const FVoxelIslandEditSphere& Sphere : Shape.Spheres)
+	{
+		const int32 ShellExtent = Sphere.Radius + 1;
+		for (int32 Z = -ShellExtent; Z <= ShellExtent; Z++)
+		{
+			for (int32 Y = -ShellExtent; Y <= ShellExtent; Y++)
+			{
+				for (int32 X = -ShellExtent; X <= ShellExtent; X++)
+				{
+					const FIntVector Pos = Sphere.Center + FIntVector(X, Y, Z);
+					if (Shape.IsCarved(Pos))
+					{
+						continue;
+					}
+
+					if (AnyNeighbor<Connectivity>(Pos, [&](const FIntVector& Neighbor) { return Shape.IsCarved(Neighbor); }))
+					{
+						Visit(Pos);
+					}
+				}
+			}
+		}
+	}
+}
+
+// Frontier order for the floods: lowest Z first, so a flood attached to terrain heads straight for
+// the ground anchor instead of wandering sideways through a tall structure
+struct FVoxelLowerZFirst
+{
+	FORCEINLINE bool operator()(const FIntVector& A, const FIntVector& B) const
+	{
+		return A.Z < B.Z;
+	}
+};
+
+// One flood started from the carved shell. Floods that touch are merged with union-find; the
+// surviving root owns the combined frontier and voxel list.
+struct FVoxelIslandFlood
+{
+	// Binary heap ordered by FVoxelLowerZFirst
+	TArray<FIntVector> Frontier;
+	TArray<FIntVector> Voxels;
+	int32 Parent = 0;
+	bool bGrounded = false;
+
+	// Ran out of budget or left the search box - grounding could not be decided
+	bool bUndecided = false;
+
+	bool IsActive() const
+	{
+		return !bGrounded && !bUndecided && Frontier.Num() > 0;
+	}
+
+	EVoxelGroundReachability GetReachability() const
+	{
+		if (bGrounded)
+		{
+			return EVoxelGroundReachability::Grounded;
+		}
+		return bUndecided || Frontier.Num() > 0 ? EVoxelGroundReachability::Unknown : EVoxelGroundReachability::Floating;
+	}
+};
+
+static int32 FindFloodRoot(TArray<FVoxelIslandFlood>& Floods, int32 Index)
+{
+	while (Floods[Index].Parent != Index)
+	{
+		Floods[Index].Parent = Floods[Floods[Index].Parent].Parent;
+		Index = Floods[Index].Parent;
+	}
+	return Index;
+}
+
+// Merges the two floods and returns the surviving root (the one with more voxels, so fewer are moved)
+static int32 MergeFloods(TArray<FVoxelIslandFlood>& Floods, int32 A, int32 B)
+{
+	if (Floods[A].Voxels.Num() < Floods[B].Voxels.Num())
+	{
+		Swap(A, B);
+	}
+
+	FVoxelIslandFlood& Root = Floods[A];
+	FVoxelIslandFlood& Child = Floods[B];
+	Root.Frontier.Append(Child.Frontier);
+	Root.Frontier.Heapify(FVoxelLowerZFirst());
+	Root.Voxels.Append(Child.Voxels);
+	Root.bGrounded |= Child.bGrounded;
+	Root.bUndecided |= Child.bUndecided;
+	Child.Frontier.Reset();
+	Child.Voxels.Reset();
+	Child.Parent = A;
+	return A;
+}
+
+// Voxel -> flood that claimed it, with no hash in the per-voxel path. A visited bit grid over the search
+// box answers "claimed at all", and every brick a flood reaches gets a page of flood ids, one per voxel,
+// found through a dense brick table. Ids are the flood index at claim time; FindFloodRoot resolves merges.
+struct FVoxelFloodOwners
+{
+	static constexpr int32 VoxelsPerBrick = FVoxelIslandBitGrid::BrickSize * FVoxelIslandBitGrid::BrickSize * FVoxelIslandBitGrid::BrickSize;
+
+	FVoxelIslandBitGrid Visited;
+
+	// Brick -> first index of its page in Ids, INDEX_NONE until a flood reaches the brick
+	TArray<int32> BrickPages;
+	TArray<int32> Ids;
+	int32 NumVisited = 0;
+
+	void Init(const FIntVector& Min, const FIntVector& Max)
+	{
+		Visited.Init(Min, Max);
+		BrickPages.Reset();
+		BrickPages.Init(INDEX_NONE, Visited.NumBricks.X * Visited.NumBricks.Y * Visited.NumBricks.Z);
+		Ids.Reset();
+		NumVisited = 0;
+	}
+
+	// Position must be inside the search box. Returns the claiming flood, or INDEX_NONE.
+	FORCEINLINE int32 Find(const FIntVector& Pos) const
+	{
+		int32 BrickIndex;
+		int32 VoxelIndex;
+		Locate(Pos, BrickIndex, VoxelIndex);
+		if ((Visited.Words[BrickIndex * FVoxelIslandBitGrid::WordsPerBrick + (VoxelIndex >> 6)] & (uint64(1) << (VoxelIndex & 63))) == 0)
+		{
+			return INDEX_NONE;
+		}
+		return Ids[BrickPages[BrickIndex] + VoxelIndex];
+	}
+
+	FORCEINLINE void Add(const FIntVector& Pos, int32 FloodIndex)
+	{
+		int32 BrickIndex;
+		int32 VoxelIndex;
+		Locate(Pos, BrickIndex, VoxelIndex);
+		Visited.Words[BrickIndex * FVoxelIslandBitGrid::WordsPerBrick + (VoxelIndex >> 6)] |= uint64(1) << (VoxelIndex & 63);
+
+		int32& Page = BrickPages[BrickIndex];
+		if (Page == INDEX_NONE)
+		{
+			Page = Ids.Num();
+			Ids.AddUninitialized(VoxelsPerBrick);
+		}
+		Ids[Page + VoxelIndex] = FloodIndex;
+		NumVisited++;
+	}
+
+	int64 GetAllocatedSize() const
+	{
+		return Visited.GetAllocatedSize() + BrickPages.GetAllocatedSize() + Ids.GetAllocatedSize();
+	}
+
+private:
+	// Same brick layout as FVoxelIslandBitGrid: VoxelIndex = Z * 64 + Y * 8 + X inside the brick
+	FORCEINLINE void Locate(const FIntVector& Pos, int32& OutBrickIndex, int32& OutVoxelIndex) const
+	{
+		const int32 LX = Pos.X - Visited.Min.X;
+		const int32 LY = Pos.Y - Visited.Min.Y;
+		const int32 LZ = Pos.Z - Visited.Min.Z;
+
+		OutBrickIndex = (LX >> 3) + Visited.NumBricks.X * ((LY >> 3) + Visited.NumBricks.Y * (LZ >> 3));
+		OutVoxelIndex = ((LZ & 7) << 6) | ((LY & 7) << 3) | (LX & 7);
+	}
+};
+
+struct FVoxelIslandScratch::FImpl
+{
+	// Flood race
+	FVoxelFloodOwners Owners;
+	TArray<FVoxelIslandFlood> Floods;
+
+	// Frontier and voxel arrays of floods from earlier detections, handed to new floods
+	TArray<TArray<FIntVector>> SpareArrays;
+
+	// Live chunk cache, see FVoxelLiveOccupancy
+	TMap<FIntVector, int32> ChunkIndex;
+	TArray<TUniquePtr<FVoxelOccupancyBuffer>> ChunkPool;
+
+	// Brick labeling
+	FVoxelOccupancyBuffer Snapshot;
+	FVoxelBrickLabeling Labeling;
+	TSet<int32> ShellRoots;
+
+	// Parallel flood, see FVoxelParallelFlood
+	FVoxelIslandBitGrid Claimed;
+	FVoxelIslandBitGrid Settled;
+	TArray<FIntVector> ComponentVoxels;
+	TArray<TArray<FIntVector>> TaskFrontiers;
+
+	void ResetFloods()
+	{
+		for (FVoxelIslandFlood& Flood : Floods)
+		{
+			Flood.Frontier.Reset();
+			Flood.Voxels.Reset();
+			SpareArrays.Add(MoveTemp(Flood.Frontier));
+			SpareArrays.Add(MoveTemp(Flood.Voxels));
+		}
+		Floods.Reset();
+	}
+
+	int32 AddFlood()
+	{
+		const int32 FloodIndex = Floods.AddDefaulted();
+		FVoxelIslandFlood& Flood = Floods[FloodIndex];
+		Flood.Parent = FloodIndex;
+		if (SpareArrays.Num() >= 2)
+		{
+			Flood.Frontier = SpareArrays.Pop(EAllowShrinking::No);
+			Flood.Voxels = SpareArrays.Pop(EAllowShrinking::No);
+		}
+		return FloodIndex;
+	}
+
+	int64 GetAllocatedSize() const
+	{
+		int64 Size = Owners.GetAllocatedSize() + Floods.GetAllocatedSize() + SpareArrays.GetAllocatedSize() +
+			ChunkIndex.GetAllocatedSize() + ChunkPool.GetAllocatedSize() + ShellRoots.GetAllocatedSize() +
+			Snapshot.Solid.GetAllocatedSize() + Snapshot.Values.GetAllocatedSize() +
+			Claimed.GetAllocatedSize() + Settled.GetAllocatedSize() + ComponentVoxels.GetAllocatedSize() + TaskFrontiers.GetAllocatedSize();
+		for (const FVoxelIslandFlood& Flood : Floods)
+		{
+			Size += Flood.Frontier.GetAllocatedSize() + Flood.Voxels.GetAllocatedSize();
+		}
+		for (const TArray<FIntVector>& Spare : SpareArrays)
+		{
+			Size += Spare.GetAllocatedSize();
+		}
+		for (const TArray<FIntVector>& TaskFrontier : TaskFrontiers)
+		{
+			Size += TaskFrontier.GetAllocatedSize();
+		}
+		for (const TUniquePtr<FVoxelOccupancyBuffer>& Chunk : ChunkPool)
+		{
+			Size += Chunk->Solid.GetAllocatedSize() + Chunk->Values.GetAllocatedSize();
+		}
+		return Size;
+	}
+};
+
+FVoxelIslandScratch::FVoxelIslandScratch()
+	: Impl(MakeUnique<FImpl>())
+{
+}
+
+FVoxelIslandScratch::~FVoxelIslandScratch() = default;
+
+int64 FVoxelIslandScratch::GetAllocatedSize() const
+{
+	return Impl->GetAllocatedSize();
+}
+
+// State of one flood race. Kept outside the call stack so a race can be advanced a slice at a time
+// across frames (FVoxelIslandDetectionJob) and still finish exactly like an uninterrupted run.
+struct FVoxelFloodRace
+{
+	// Steps one flood takes before the next flood gets its turn
+	static constexpr int32 StepsPerRound = 64;
+
+	FIntVector SearchMin;
+	FIntVector SearchMax;
+	FVoxelIslandEditShape Shape;
+	FVoxelIslandDetectionSettings Settings;
+
+	FVoxelIslandScratch::FImpl& Scratch;
+
+	// Voxel -> flood that claimed it, over the search box
+	FVoxelFloodOwners& Owners;
+	TArray<FVoxelIslandFlood>& Floods;
+
+	int32 TotalSteps = 0;
+
+	// Flood whose turn is next; Floods.Num() means a new round starts
+	int32 NextFlood = 0;
+	bool bAnyActive = true;
+	bool bFinished = false;
+
+	FVoxelFloodRace(FVoxelIslandScratch::FImpl& InScratch, const FIntVector& InSearchMin, const FIntVector& InSearchMax, const FVoxelIslandEditShape& InShape, const FVoxelIslandDetectionSettings& InSettings)
+		: SearchMin(InSearchMin)
+		, SearchMax(InSearchMax)
+		, Shape(InShape)
+		, Settings(InSettings)
+		, Scratch(InScratch)
+		, Owners(InScratch.Owners)
+		, Floods(InScratch.Floods)
+	{
+		Scratch.ResetFloods();
+		Owners.Init(SearchMin, SearchMax);
+	}
+
+	FORCEINLINE bool IsInSearchBox(const FIntVector& Pos) const
+	{
+		return Pos.X >= SearchMin.X && Pos.X <= SearchMax.X &&
+			Pos.Y >= SearchMin.Y && Pos.Y <= SearchMax.Y &&
+			Pos.Z >= SearchMin.Z && Pos.Z <= SearchMax.Z;
+	}
+
+	// True when every neighbor of Pos, under any connectivity, is inside the search box
+	FORCEINLINE bool IsInSearchBoxInterior(const FIntVector& Pos) const
+	{
+		return Pos.X > SearchMin.X && Pos.X < SearchMax.X &&
+			Pos.Y > SearchMin.Y && Pos.Y < SearchMax.Y &&
+			Pos.Z > SearchMin.Z && Pos.Z < SearchMax.Z;
+	}
+
+	template<typename TOccupancy>
+	void Seed(const TOccupancy& Occupancy)
+	{
+		DispatchConnectivity(Settings.Connectivity, [&](auto Connectivity)
+		{
+			SeedImpl<decltype(Connectivity)::Value>(Occupancy);
+		});
+	}
+
+	// Seed from solid voxels just outside the carved sphere that face into it. Seeds adjacent to an
+	// existing seed join its flood so a smooth shell starts a handful of floods, not hundreds.
+	template<EVoxelConnectivity Connectivity, typename TOccupancy>
+	void SeedImpl(const TOccupancy& Occupancy)
+	{
+		ForEachShellVoxel<Connectivity>(Shape, [&](const FIntVector& Pos)
+		{
+			if (!IsInSearchBox(Pos) || Owners.Find(Pos) != INDEX_NONE || !Occupancy.IsSolid(Pos))
+			{
+				return;
+			}
+
+			int32 FloodIndex = INDEX_NONE;
+			ForEachNeighbor<Connectivity>(Pos, [&](const FIntVector& Neighbor)
+			{
+				const int32 NeighborOwner = IsInSearchBox(Neighbor) ? Owners.Find(Neighbor) : INDEX_NONE;
+				if (NeighborOwner != INDEX_NONE)
+				{
+					const int32 NeighborRoot = FindFloodRoot(Floods, NeighborOwner);
+					FloodIndex = FloodIndex == INDEX_NONE ? NeighborRoot :
+						(FloodIndex == NeighborRoot ? FloodIndex : MergeFloods(Floods, FloodIndex, NeighborRoot));
+				}
+			});
+
+			if (FloodIndex == INDEX_NONE)
+			{
+				FloodIndex = Scratch.AddFlood();
+			}
+
+			Owners.Add(Pos, FloodIndex);
+			Floods[FloodIndex].Frontier.HeapPush(Pos, FVoxelLowerZFirst());
+			Floods[FloodIndex].Voxels.Add(Pos);
+			Floods[FloodIndex].bGrounded |= Settings.IsAnchor(Pos);
+		});
+
+		NextFlood = Floods.Num();
+
+		UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Started %d floods from the carved shell (%d spheres)"), Floods.Num(), Shape.Spheres.Num());
+	}
+
+	// Race the floods a slice at a time. Small detached pieces run dry within a few rounds, while the
+	// flood attached to terrain descends best-first and is stopped as soon as it touches ground, so
+	// total work tracks the smallest pieces rather than the search volume.
+	// Returns true once the race is over; with EndTime > 0 it also returns after the first slice past EndTime.
+	template<typename TOccupancy>
+	bool Advance(const TOccupancy& Occupancy, double EndTime)
+	{
+		return DispatchConnectivity(Settings.Connectivity, [&](auto Connectivity)
+		{
+			return AdvanceImpl<decltype(Connectivity)::Value>(Occupancy, EndTime);
+		});
+	}
+
+	template<EVoxelConnectivity Connectivity, typename TOccupancy>
+	bool AdvanceImpl(const TOccupancy& Occupancy, double EndTime)
+	{
+		while (!bFinished)
+		{
+			if (NextFlood >= Floods.Num())
+			{
+				if (!bAnyActive || TotalSteps >= Settings.MaxFloodFillIterations)
+				{
+					bFinished = true;
+					break;
+				}
+				bAnyActive = false;
+				NextFlood = 0;
+			}
+
+			const int32 FloodIndex = NextFlood++;
+			if (Floods[FloodIndex].Parent != FloodIndex || !Floods[FloodIndex].IsActive())
+			{
+				continue;
+			}
+
+			StepFlood<Connectivity>(Occupancy, FloodIndex);
+
+			if (EndTime > 0.0 && FPlatformTime::Seconds() >= EndTime)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template<EVoxelConnectivity Connectivity, typename TOccupancy>
+	void StepFlood(const TOccupancy& Occupancy, int32 Root)
+	{
+		for (int32 Step = 0; Step < StepsPerRound && Floods[Root].IsActive(); Step++)
+		{
+			TotalSteps++;
+			FIntVector Current;
+			Floods[Root].Frontier.HeapPop(Current, FVoxelLowerZFirst(), EAllowShrinking::No);
+
+			// Box test once per voxel: away from the box faces no neighbor can leave it
+			if (IsInSearchBoxInterior(Current))
+			{
+				Root = ExpandVoxel<Connectivity, true>(Occupancy, Current, Root);
+			}
+			else
+			{
+				Root = ExpandVoxel<Connectivity, false>(Occupancy, Current, Root);
+			}
+
+			// Pieces larger than MaxIslandVoxels are never made to fall - stop spending budget on them
+			if (Floods[Root].Voxels.Num() > Settings.MaxIslandVoxels)
+			{
+				Floods[Root].bUndecided = true;
+			}
+		}
+
+		if (Floods[Root].IsActive())
+		{
+			bAnyActive = true;
+		}
+	}
+
+	// Claims the solid neighbors of Current for the flood. Returns the flood's root, which changes when
+	// Current touches another flood and the two are merged.
+	template<EVoxelConnectivity Connectivity, bool bInterior, typename TOccupancy>
+	FORCEINLINE int32 ExpandVoxel(const TOccupancy& Occupancy, const FIntVector& Current, int32 Root)
+	{
+		ForEachNeighbor<Connectivity>(Current, [&](const FIntVector& Neighbor)
+		{
+			// Leaving the search box means we can't prove the piece is floating
+			if constexpr (!bInterior)
+			{
+				if (!IsInSearchBox(Neighbor))
+				{
+					if (Occupancy.IsSolidOrUnknown(Neighbor))
+					{
+						Floods[Root].bUndecided = true;
+					}
+					return;
+				}
+			}
+
+			const int32 NeighborOwner = Owners.Find(Neighbor);
+			if (NeighborOwner != INDEX_NONE)
+			{
+				// Two fronts met - they are the same component
+				const int32 NeighborRoot = FindFloodRoot(Floods, NeighborOwner);
+				if (NeighborRoot != Root)
+				{
+					Root = MergeFloods(Floods, Root, NeighborRoot);
+				}
+				return;
+			}
+
+			if (!Occupancy.IsSolid(Neighbor))
+			{
+				return;
+			}
+
+			Owners.Add(Neighbor, Root);
+			Floods[Root].Frontier.HeapPush(Neighbor, FVoxelLowerZFirst());
+			Floods[Root].Voxels.Add(Neighbor);
+
+			// The first anchor hit decides the flood, there is no need to walk further down
+			if (Settings.IsAnchor(Neighbor))
+			{
+				Floods[Root].bGrounded = true;
+			}
+		});
+
+		return Root;
+	}
+
+	// Roots that ran dry without touching ground are the detached islands. Undecided roots are left
+	// in place - a budget miss is not proof that a piece is floating.
+	TArray<FVoxelIsland> GatherIslands() const
+	{
+		TArray<FVoxelIsland> Islands;
+
+		if (bAnyActive)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[ISLAND TRUNCATED] Flood race hit iteration limit (%d), unfinished pieces are left in place"), Settings.MaxFloodFillIterations);
+		}
+
+		int32 NumUnknown = 0;
+		for (int32 FloodIndex = 0; FloodIndex < Floods.Num(); FloodIndex++)
+		{
+			const FVoxelIslandFlood& Flood = Floods[FloodIndex];
+			if (Flood.Parent != FloodIndex)
+			{
+				continue;
+			}
+
+			const EVoxelGroundReachability Reachability = Flood.GetReachability();
+			if (Reachability == EVoxelGroundReachability::Unknown)
+			{
+				NumUnknown++;
+			}
+			else if (Reachability == EVoxelGroundReachability::Floating && Flood.Voxels.Num() >= 5)
+			{
+				Islands.Add(MakeFloatingIsland(Flood.Voxels));
+			}
+		}
+
+		if (NumUnknown > 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[GROUND UNKNOWN] %d pieces hit the search budget or box edge before reaching ground, leaving them in place"), NumUnknown);
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Found %d islands in area (%d flood steps, %d voxels visited)"), Islands.Num(), TotalSteps, Owners.NumVisited);
+		return Islands;
+	}
+};
+
+template<typename TOccupancy>
+static TArray<FVoxelIsland> DetectIslandsImpl(FVoxelIslandScratch::FImpl& Scratch, const TOccupancy& Occupancy, const FIntVector& SearchMin, const FIntVector& SearchMax, const FVoxelIslandEditShape& Shape, const FVoxelIslandDetectionSettings& Settings)
+{
+	FVoxelFloodRace Race(Scratch, SearchMin, SearchMax, Shape, Settings);
+	Race.Seed(Occupancy);
+	Race.Advance(Occupancy, 0.0);
+	return Race.GatherIslands();
+}
+
+// Labels the whole snapshot at once and keeps the detached components that touch the carved shell
+static TArray<FVoxelIsland> LabelIslandsImpl(FVoxelIslandScratch::FImpl& Scratch, const FVoxelIslandBitGrid& Solid, const FVoxelIslandEditShape& Shape, const FVoxelIslandDetectionSettings& Settings)
+{
+	TArray<FVoxelIsland> Islands;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	FVoxelBrickLabeling& Labeling = Scratch.Labeling;
+	Labeling.Label(Solid, Settings.Anchors.Get());
+
+	TSet<int32>& ShellRoots = Scratch.ShellRoots;
+	ShellRoots.Reset();
+	// Bricks are labeled 6-connected
+	ForEachShellVoxel<EVoxelConnectivity::Faces6>(Shape, [&](const FIntVector& Pos)
+	{
+		const int32 Root = Labeling.FindComponentAt(Pos);
+		if (Root != INDEX_NONE)
+		{
+			ShellRoots.Add(Root);
+		}
+	});
+
+	for (const int32 Root : ShellRoots)
+	{
+		const int64 VoxelCount = Labeling.GetRootVoxelCount(Root);
+		if (Labeling.IsRootGrounded(Root) || VoxelCount < 5)
+		{
+			continue;
+		}
+
+		// Same large-island rule as the flood fill - big pieces are treated as terrain
+		if (VoxelCount > Settings.MaxIslandVoxels)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SKIPPING LARGE ISLAND] Island too large (%lld voxels > %d limit), likely terrain/ground - ignoring"),
+				VoxelCount, Settings.MaxIslandVoxels);
+			continue;
+		}
+
+		TArray<FIntVector> Voxels;
+		Voxels.Reserve(VoxelCount);
+		Labeling.GatherVoxels(Root, Voxels);
+		Islands.Add(MakeFloatingIsland(MoveTemp(Voxels)));
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Brick labeling found %d islands in %.2fms (%d brick components, %d touching the edit)"),
+		Islands.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0, Labeling.GetNumComponents(), ShellRoots.Num());
+	return Islands;
+}
+
+// Level-synchronous BFS over a snapshot for components too large for one thread. Each shell seed not
+// yet reached explores its whole component one frontier level at a time; once the component holds
+// ParallelFloodMinVoxels voxels, wide levels are split across task graph workers, which claim voxels
+// with atomic bit grid ORs so every voxel is expanded once. A component stops early once it reaches an
+// anchor, leaves the snapshot, grows past MaxIslandVoxels or touches a component already stopped that
+// way. Components are disjoint, so the islands are the same as the flood race's no matter how the
+// levels are split. Like the race, every expanded voxel is charged to MaxFloodFillIterations, and a
+// component the budget runs out in is left undecided.
+struct FVoxelParallelFlood
+{
+	// Frontier voxels per task; smaller levels run on the calling thread
+	static constexpr int32 VoxelsPerTask = 2048;
+
+	const FVoxelIslandBitGrid& Solid;
+	const FVoxelIslandEditShape& Shape;
+	const FVoxelIslandDetectionSettings& Settings;
+	FVoxelIslandScratch::FImpl& Scratch;
+
+	int64 TotalSteps = 0;
+	int32 NumLevels = 0;
+	int32 NumUnknown = 0;
+
+	template<EVoxelConnectivity Connectivity>
+	TArray<FVoxelIsland> Run()
+	{
+		TArray<FVoxelIsland> Islands;
+
+		// Claimed: reached by any component. Settled: belongs to a component that was stopped early.
+		Scratch.Claimed.Init(Solid.Min, Solid.Max);
+		Scratch.Settled.Init(Solid.Min, Solid.Max);
+
+		bool bTruncated = false;
+		ForEachShellVoxel<Connectivity>(Shape, [&](const FIntVector& Seed)
+		{
+			if (bTruncated || !Solid.Contains(Seed) || !Solid.Get(Seed) || Scratch.Claimed.TestAndSet(Seed))
+			{
+				return;
+			}
+
+			const EVoxelGroundReachability Reachability = FloodComponent<Connectivity>(Seed, bTruncated);
+			if (Reachability == EVoxelGroundReachability::Floating)
+			{
+				if (Scratch.ComponentVoxels.Num() >= 5)
+				{
+					Islands.Add(MakeFloatingIsland(Scratch.ComponentVoxels));
+				}
+				return;
+			}
+
+			if (Reachability == EVoxelGroundReachability::Unknown)
+			{
+				NumUnknown++;
+			}
+
+			// Later seeds that reach these voxels are part of the same component
+			for (const FIntVector& Voxel : Scratch.ComponentVoxels)
+			{
+				Scratch.Settled.Set(Voxel);
+			}
+		});
+
+		if (bTruncated)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[ISLAND TRUNCATED] Parallel flood hit iteration limit (%d), unfinished pieces are left in place"), Settings.MaxFloodFillIterations);
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Parallel flood found %d islands (%lld voxels expanded in %d levels, %d undecided)"),
+			Islands.Num(), TotalSteps, NumLevels, NumUnknown);
+		return Islands;
+	}
+
+	// Explores the component of Seed into Scratch.ComponentVoxels, stored level after level. Sets
+	// bOutTruncated when the iteration budget runs out before the component is decided.
+	template<EVoxelConnectivity Connectivity>
+	EVoxelGroundReachability FloodComponent(const FIntVector& Seed, bool& bOutTruncated)
+	{
+		TArray<FIntVector>& Voxels = Scratch.ComponentVoxels;
+		Voxels.Reset();
+		Voxels.Add(Seed);
+
+		if (Settings.IsAnchor(Seed))
+		{
+			return EVoxelGroundReachability::Grounded;
+		}
+
+		std::atomic<bool> bGrounded(false);
+		std::atomic<bool> bUnknown(false);
+
+		int32 LevelStart = 0;
+		while (LevelStart < Voxels.Num())
+		{
+			// Expand no more voxels than the budget has left, same as the race's per-step count
+			const int64 Budget = int64(Settings.MaxFloodFillIterations) - TotalSteps;
+			if (Budget <= 0)
+			{
+				bOutTruncated = true;
+				return EVoxelGroundReachability::Unknown;
+			}
+
+			const int32 LevelEnd = int32(FMath::Min<int64>(Voxels.Num(), LevelStart + Budget));
+			const bool bOutOfBudget = LevelEnd < Voxels.Num();
+			const int32 NumTasks = FMath::DivideAndRoundUp(LevelEnd - LevelStart, VoxelsPerTask);
+			NumLevels++;
+			TotalSteps += LevelEnd - LevelStart;
+
+			// Small components stay on this thread even when a level is wide
+			const bool bSplit = NumTasks > 1 && Voxels.Num() >= Settings.ParallelFloodMinVoxels;
+
+			if (Scratch.TaskFrontiers.Num() < NumTasks)
+			{
+				Scratch.TaskFrontiers.SetNum(NumTasks);
+			}
+
+			ParallelFor(NumTasks, [&](int32 TaskIndex)
+			{
+				TArray<FIntVector>& Next = Scratch.TaskFrontiers[TaskIndex];
+				Next.Reset();
+
+				const int32 TaskEnd = FMath::Min(LevelStart + (TaskIndex + 1) * VoxelsPerTask, LevelEnd);
+				for (int32 Index = LevelStart + TaskIndex * VoxelsPerTask; Index < TaskEnd; Index++)
+				{
+					ForEachNeighbor<Connectivity>(Voxels[Index], [&](const FIntVector& Neighbor)
+					{
+						// Nothing is known past the snapshot, same rule as FVoxelSnapshotOccupancy
+						if (!Solid.Contains(Neighbor))
+						{
+							bUnknown.store(true, std::memory_order_relaxed);
+							return;
+						}
+
+						if (!Solid.Get(Neighbor))
+						{
+							return;
+						}
+
+						// Settled is only written between components, so plain reads are safe here
+						if (Scratch.Settled.Get(Neighbor))
+						{
+							bUnknown.store(true, std::memory_order_relaxed);
+							return;
+						}
+
+						if (Scratch.Claimed.AtomicTestAndSet(Neighbor))
+						{
+							return;
+						}
+
+						Next.Add(Neighbor);
+						if (Settings.IsAnchor(Neighbor))
+						{
+							bGrounded.store(true, std::memory_order_relaxed);
+						}
+					});
+				}
+			}, bSplit ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+			for (int32 TaskIndex = 0; TaskIndex < NumTasks; TaskIndex++)
+			{
+				Voxels.Append(Scratch.TaskFrontiers[TaskIndex]);
+			}
+			LevelStart = LevelEnd;
+
+			if (bGrounded.load(std::memory_order_relaxed))
+			{
+				return EVoxelGroundReachability::Grounded;
+			}
+
+			if (bOutOfBudget)
+			{
+				bOutTruncated = true;
+				return EVoxelGroundReachability::Unknown;
+			}
+
+			if (bUnknown.load(std::memory_order_relaxed) || Voxels.Num() > Settings.MaxIslandVoxels)
+			{
+				return EVoxelGroundReachability::Unknown;
+			}
+		}
+
+		return EVoxelGroundReachability::Floating;
+	}
+};
+
+bool FVoxelIslandDetector::ComputeSearchBounds(const FIntVector& EditMin, const FIntVector& EditMax, const FVoxelIslandDetectionSettings& Settings, FIntVector& OutSearchMin, FIntVector& OutSearchMax)
+{
+	// Simple consistent approach: always use SearchPadding
+	OutSearchMin = EditMin - FIntVector(Settings.SearchPadding);
+	OutSearchMax = EditMax + FIntVector(Settings.SearchPadding);
+	int64 TotalVoxels = (int64)(OutSearchMax.X - OutSearchMin.X + 1) * (OutSearchMax.Y - OutSearchMin.Y + 1) * (OutSearchMax.Z - OutSearchMin.Z + 1);
+	
+	// Safety check against MaxTotalVoxels
+	if (TotalVoxels > Settings.MaxTotalVoxels)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Search volume too large (%lld > %d), skipping island detection"), TotalVoxels, Settings.MaxTotalVoxels);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Checking %lld voxels for islands"), TotalVoxels);
+	return true;
+}
+
+TArray<FVoxelIsland> FVoxelIslandDetector::DetectIslands(const FVoxelData& Data, const FIntVector& SearchMin, const FIntVector& SearchMax, const FVoxelIslandEditShape& Shape, const FVoxelIslandDetectionSettings& Settings, FVoxelIslandScratch* Scratch, FVoxelOccupancyPyramid* Pyramid)
+{
+	TOptional<FVoxelIslandScratch> LocalScratch;
+	if (!Scratch)
+	{
+		Scratch = &LocalScratch.Emplace();
+	}
+	FVoxelIslandScratch::FImpl& Impl = *Scratch->Impl;
+
+	if (Settings.bUseBrickLabeling && Settings.Connectivity == EVoxelConnectivity::Faces6)
+	{
+		// Snapshot into the pooled buffer so its words are reused by the next detection
+		Impl.Snapshot.Read(Data, SearchMin, SearchMax);
+		return LabelIslandsImpl(Impl, Impl.Snapshot.Solid, Shape, Settings);
+	}
+
+	// Get data lock for entire search area - floods read whole chunks in bulk as they reach them
+	FVoxelReadScopeLock Lock(Data, FVoxelLiveOccupancy::GetChunkAlignedLockBounds(SearchMin, SearchMax), "IslandDetection");
+
+	FVoxelLiveOccupancy Occupancy(Data, Pyramid, Impl.ChunkIndex, Impl.ChunkPool);
+	TArray<FVoxelIsland> Islands = DetectIslandsImpl(Impl, Occupancy, SearchMin, SearchMax, Shape, Settings);
+
+	UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Detection touched %d chunks, %d read in bulk, %d skipped as uniform (%lld KB scratch)"),
+		Impl.ChunkIndex.Num(), Impl.ChunkIndex.Num() - Occupancy.NumSkippedReads, Occupancy.NumSkippedReads, Impl.GetAllocatedSize() / 1024);
+	return Islands;
+}
+
+void FVoxelIslandDetector::SnapshotOccupancy(const FVoxelData& Data, const FIntVector& SearchMin, const FIntVector& SearchMax, FVoxelIslandBitGrid& OutSolid)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Hold the lock only while copying - detection then runs on the snapshot without blocking edits
+	FVoxelOccupancyBuffer Buffer;
+	Buffer.Read(Data, SearchMin, SearchMax);
+	OutSolid = MoveTemp(Buffer.Solid);
+
+	UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Snapshot of %s..%s took %.2fms (%lld KB)"),
+		*SearchMin.ToString(), *SearchMax.ToString(), (FPlatformTime::Seconds() - StartTime) * 1000.0, OutSolid.GetAllocatedSize() / 1024);
+}
+
+TArray<FVoxelIsland> FVoxelIslandDetector::DetectIslandsInSnapshot(const FVoxelIslandBitGrid& Solid, const FVoxelIslandEditShape& Shape, const FVoxelIslandDetectionSettings& Settings, FVoxelIslandScratch* Scratch)
+{
+	TOptional<FVoxelIslandScratch> LocalScratch;
+	if (!Scratch)
+	{
+		Scratch = &LocalScratch.Emplace();
+	}
+
+	if (Settings.bUseBrickLabeling && Settings.Connectivity == EVoxelConnectivity::Faces6)
+	{
+		return LabelIslandsImpl(*Scratch->Impl, Solid, Shape, Settings);
+	}
+
+	// Only components of ParallelFloodMinVoxels voxels are split across workers, and none grows past
+	// MaxIslandVoxels before it is given up on - below that the race's best-first order wins
+	if (Settings.ParallelFloodMinVoxels > 0 && Settings.MaxIslandVoxels >= Settings.ParallelFloodMinVoxels)
+	{
+		FVoxelParallelFlood Flood{ Solid, Shape, Settings, *Scratch->Impl };
+		return DispatchConnectivity(Settings.Connectivity, [&](auto Connectivity)
+		{
+			return Flood.Run<decltype(Connectivity)::Value>();
+		});
+	}
+
+	return DetectIslandsImpl(*Scratch->Impl, FVoxelSnapshotOccupancy{ Solid }, Solid.Min, Solid.Max, Shape, Settings);
+}
+
+TArray<TArray<FVoxelIsland>> FVoxelIslandDetector::DetectIslandsBatch(TConstArrayView<FVoxelIslandBatchRequest> Requests, FVoxelIslandScratch* Scratch)
+{
+	TOptional<FVoxelIslandScratch> LocalScratch;
+	if (!Scratch)
+	{
+		Scratch = &LocalScratch.Emplace();
+	}
+	FVoxelIslandScratch::FImpl& Impl = *Scratch->Impl;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<TArray<FVoxelIsland>> Results;
+	Results.SetNum(Requests.Num());
+	for (int32 Index = 0; Index < Requests.Num(); Index++)
+	{
+		const FVoxelIslandBatchRequest& Request = Requests[Index];
+		if (!Request.Data)
+		{
+			continue;
+		}
+
+		// Every world's snapshot goes through the same pooled buffer
+		Impl.Snapshot.Read(*Request.Data, Request.SearchMin, Request.SearchMax);
+		Results[Index] = DetectIslandsInSnapshot(Impl.Snapshot.Solid, Request.Shape, Request.Settings, Scratch);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Batched detection of %d worlds took %.2fms (%lld KB scratch)"),
+		Requests.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0, Impl.GetAllocatedSize() / 1024);
+	return Results;
+}
+
+int32 FVoxelIslandDetector::CountSolidVoxels(const FVoxelData& Data, const FVoxelIsland& Island)
+{
+	if (Island.Voxels.Num() == 0)
+	{
+		return 0;
+	}
+
+	FVoxelOccupancyBuffer Occupancy;
+	Occupancy.Read(Data, Island.MinBounds, Island.MaxBounds);
+
+	int32 SolidCount = 0;
+	for (const FIntVector Pos : Island.Voxels)
+	{
+		if (Occupancy.IsSolid(Pos))
+		{
+			SolidCount++;
+		}
+	}
+	return SolidCount;
+}
+
+struct FVoxelIslandDetectionJob::FState
+{
+	FVoxelLiveOccupancy Occupancy;
+	FVoxelFloodRace Race;
+	bool bSeeded = false;
+
+	FState(FVoxelIslandScratch::FImpl& Scratch, const FVoxelData& Data, FVoxelOccupancyPyramid* Pyramid, const FIntVector& SearchMin, const FIntVector& SearchMax, const FVoxelIslandEditShape& Shape, const FVoxelIslandDetectionSettings& Settings)
+		: Occupancy(Data, Pyramid, Scratch.ChunkIndex, Scratch.ChunkPool)
+		, Race(Scratch, SearchMin, SearchMax, Shape, Settings)
+	{
+	}
+};
+
+FVoxelIslandDetectionJob::FVoxelIslandDetectionJob(const FIntVector& InSearchMin, const FIntVector& InSearchMax, const FVoxelIslandEditShape& InShape, const FVoxelIslandDetectionSettings& InSettings, FVoxelIslandScratch* InScratch, FVoxelOccupancyPyramid* InPyramid)
+	: SearchMin(InSearchMin)
+	, SearchMax(InSearchMax)
+	, Shape(InShape)
+	, Settings(InSettings)
+	, Scratch(InScratch)
+	, Pyramid(InPyramid)
+{
+	if (!Scratch)
+	{
+		OwnedScratch = MakeUnique<FVoxelIslandScratch>();
+		Scratch = OwnedScratch.Get();
+	}
+}
+
+FVoxelIslandDetectionJob::~FVoxelIslandDetectionJob() = default;
+
+bool FVoxelIslandDetectionJob::Tick(const FVoxelData& Data, double BudgetSeconds)
+{
+	if (bFinished)
+	{
+		return true;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	NumTicks++;
+
+	if (Settings.bUseBrickLabeling && Settings.Connectivity == EVoxelConnectivity::Faces6)
+	{
+		Islands = FVoxelIslandDetector::DetectIslands(Data, SearchMin, SearchMax, Shape, Settings, Scratch, Pyramid);
+		bFinished = true;
+	}
+	else
+	{
+		if (!State || &State->Occupancy.Data != &Data)
+		{
+			State = MakeUnique<FState>(*Scratch->Impl, Data, Pyramid, SearchMin, SearchMax, Shape, Settings);
+		}
+
+		// Chunks read in earlier ticks stay cached; the lock only has to cover this slice
+		FVoxelReadScopeLock Lock(Data, FVoxelLiveOccupancy::GetChunkAlignedLockBounds(SearchMin, SearchMax), "IslandDetectionJob");
+
+		if (!State->bSeeded)
+		{
+			State->Race.Seed(State->Occupancy);
+			State->bSeeded = true;
+		}
+
+		if (State->Race.Advance(State->Occupancy, StartTime + BudgetSeconds))
+		{
+			Islands = State->Race.GatherIslands();
+			State.Reset();
+			bFinished = true;
+		}
+	}
+
+	TotalSeconds += FPlatformTime::Seconds() - StartTime;
+	return bFinished;
+}
+
+void FVoxelIslandDetectionJob::Restart()
+{
+	State.Reset();
+	Islands.Reset();
+	bFinished = false;
+}
+
+bool FVoxelIslandDetectionJob::Overlaps(const FIntVector& Min, const FIntVector& Max) const
+{
+	return Min.X <= SearchMax.X && Max.X >= SearchMin.X &&
+		Min.Y <= SearchMax.Y && Max.Y >= SearchMin.Y &&
+		Min.Z <= SearchMax.Z && Max.Z >= SearchMin.Z;
+}
@@ -0,0 +1,218 @@
+// VoxelIslandDetection.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelIslandBitGrid.h"
+#include "VoxelGroundAnchorIndex.h"
+
+class FVoxelData;
+struct FVoxelIsland;
+class FVoxelOccupancyPyramid;
+
+// Which voxels count as touching when deciding whether two pieces are still one
+enum class EVoxelConnectivity : uint8
+{
+	// Shared faces only
+	Faces6,
+	// Faces and edges
+	Edges18,
+	// Faces, edges and corners
+	Corners26
+};
+
+/**
+ * Copy of the UVoxelIslandPhysics detection parameters taken when a detection starts,
+ * so a detection running on a worker thread never reads the component
+ */
+struct FVoxelIslandDetectionSettings
+{
+	int32 SearchPadding = 8;
+	int32 MaxFloodFillIterations = 50000;
+	int32 MaxTotalVoxels = 25000000;
+	int32 MaxIslandVoxels = 10000;
+
+	// Label the whole search box brick by brick instead of racing floods from the carved shell.
+	// Brick labeling is 6-connected and is only used with Faces6.
+	bool bUseBrickLabeling = false;
+
+	EVoxelConnectivity Connectivity = EVoxelConnectivity::Faces6;
+
+	// Snapshot detections flood components of at least this many voxels level by level on the task graph
+	// (0 = never). Only used when MaxIslandVoxels lets a component grow that large.
+	int32 ParallelFloodMinVoxels = 100000;
+
+	// Voxels that hold pieces up. Without an index, anything at or below Z = 0 is ground.
+	TSharedPtr<const FVoxelGroundAnchorIndex> Anchors;
+
+	FORCEINLINE bool IsAnchor(const FIntVector& Pos) const
+	{
+		return Anchors.IsValid() ? Anchors->IsAnchor(Pos) : Pos.Z <= 0;
+	}
+};
+
+// Outcome of a ground search. Unknown means the search ran out of budget (or left the known region)
+// before deciding - callers must not treat it as floating.
+enum class EVoxelGroundReachability : uint8
+{
+	Grounded,
+	Floating,
+	Unknown
+};
+
+// Carved sphere in voxel coordinates
+struct FVoxelIslandEditSphere
+{
+	FIntVector Center = FIntVector::ZeroValue;
+	int32 Radius = 0;
+};
+
+// Spheres carved by one edit, or by several coalesced digs - detection seeds from the solid voxels facing them
+struct FVoxelIslandEditShape
+{
+	TArray<FVoxelIslandEditSphere> Spheres;
+
+	void AddSphere(const FIntVector& Center, int32 Radius)
+	{
+		Spheres.Add({ Center, Radius });
+	}
+
+	bool IsCarved(const FIntVector& Pos) const
+	{
+		for (const FVoxelIslandEditSphere& Sphere : Spheres)
+		{
+			const FIntVector Delta = Pos - Sphere.Center;
+			if (int64(Delta.X) * Delta.X + int64(Delta.Y) * Delta.Y + int64(Delta.Z) * Delta.Z <= int64(Sphere.Radius) * Sphere.Radius)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Inclusive voxel box around every sphere, grown by Padding
+	void GetBounds(int32 Padding, FIntVector& OutMin, FIntVector& OutMax) const
+	{
+		OutMin = FIntVector(MAX_int32);
+		OutMax = FIntVector(MIN_int32);
+		for (const FVoxelIslandEditSphere& Sphere : Spheres)
+		{
+			const int32 Extent = Sphere.Radius + Padding;
+			OutMin = FIntVector(FMath::Min(OutMin.X, Sphere.Center.X - Extent), FMath::Min(OutMin.Y, Sphere.Center.Y - Extent), FMath::Min(OutMin.Z, Sphere.Center.Z - Extent));
+			OutMax = FIntVector(FMath::Max(OutMax.X, Sphere.Center.X + Extent), FMath::Max(OutMax.Y, Sphere.Center.Y + Extent), FMath::Max(OutMax.Z, Sphere.Center.Z + Extent));
+		}
+	}
+};
+
+// One world's part of a batched detection. Data must stay alive until the batch returns.
+struct FVoxelIslandBatchRequest
+{
+	const FVoxelData* Data = nullptr;
+	FIntVector SearchMin = FIntVector::ZeroValue;
+	FIntVector SearchMax = FIntVector::ZeroValue;
+	FVoxelIslandEditShape Shape;
+	FVoxelIslandDetectionSettings Settings;
+};
+
+/**
+ * Reusable temporaries for island detection: flood state, cached chunk reads and the labeling snapshot.
+ * Containers are reset rather than freed between detections, so once they have grown to the size of a
+ * typical dig, detection stops allocating. A scratch serves one detection at a time.
+ */
+class FVoxelIslandScratch
+{
+public:
+	FVoxelIslandScratch();
+	~FVoxelIslandScratch();
+
+	int64 GetAllocatedSize() const;
+
+	// Defined in VoxelIslandDetection.cpp
+	struct FImpl;
+
+private:
+	friend class FVoxelIslandDetector;
+	friend class FVoxelIslandDetectionJob;
+
+	TUniquePtr<FImpl> Impl;
+};
+
+/**
+ * Island detection algorithms, independent of any UObject.
+ * The live variants read FVoxelData directly; the snapshot variants only touch the bit grid and are
+ * safe to run off the game thread.
+ */
+class FVoxelIslandDetector
+{
+public:
+	// Pads the edit box by SearchPadding and rejects it if it exceeds MaxTotalVoxels
+	static bool ComputeSearchBounds(const FIntVector& EditMin, const FIntVector& EditMax, const FVoxelIslandDetectionSettings& Settings, FIntVector& OutSearchMin, FIntVector& OutSearchMax);
+
+	// Races one flood per solid piece around the carved shell against live data, holding a read lock over
+	// the search box. Floods that meet are merged; floods that run dry before reaching ground are islands.
+	// Scratch is optional; without one the temporaries are allocated for this call only.
+	// Pyramid is optional too: chunks it knows to be uniform are not read, and chunks that are read update it.
+	static TArray<FVoxelIsland> DetectIslands(const FVoxelData& Data, const FIntVector& SearchMin, const FIntVector& SearchMax, const FVoxelIslandEditShape& Shape, const FVoxelIslandDetectionSettings& Settings, FVoxelIslandScratch* Scratch = nullptr, FVoxelOccupancyPyramid* Pyramid = nullptr);
+
+	// Copies solid/empty state of the search box into a bit grid, holding the read lock only while copying
+	static void SnapshotOccupancy(const FVoxelData& Data, const FIntVector& SearchMin, const FIntVector& SearchMax, FVoxelIslandBitGrid& OutSolid);
+
+	// Same flood race as DetectIslands, run on a snapshot. Floods that leave the snapshot count as grounded.
+	// Large components (Settings.ParallelFloodMinVoxels) are flooded level by level on the task graph instead.
+	static TArray<FVoxelIsland> DetectIslandsInSnapshot(const FVoxelIslandBitGrid& Solid, const FVoxelIslandEditShape& Shape, const FVoxelIslandDetectionSettings& Settings, FVoxelIslandScratch* Scratch = nullptr);
+
+	// Snapshots and detects every request in turn through one scratch, so an edit that hits several worlds
+	// costs one task and one set of buffers. Each snapshot's lock is held only while copying it.
+	// Returns one island list per request, in request order. Safe off the game thread.
+	static TArray<TArray<FVoxelIsland>> DetectIslandsBatch(TConstArrayView<FVoxelIslandBatchRequest> Requests, FVoxelIslandScratch* Scratch = nullptr);
+
+	// How many of the island's voxels are still solid, read in bulk over its bounds.
+	// Lets a result that waited a few frames be checked against edits made in the meantime.
+	static int32 CountSolidVoxels(const FVoxelData& Data, const FVoxelIsland& Island);
+};
+
+/**
+ * Resumable flood race for the game thread. Each Tick advances the race until its time budget is spent,
+ * taking the read lock only for that slice; floods, frontiers and visited voxels carry over between ticks,
+ * so the finished job returns what DetectIslands would have returned for the same data.
+ * Brick labeling has no resumable form and runs in full on the first tick.
+ */
+class FVoxelIslandDetectionJob
+{
+public:
+	// Scratch must outlive the job and must not be used by anything else while the job has progress.
+	// Without one the job allocates its own. Pyramid, if given, must outlive the job as well.
+	FVoxelIslandDetectionJob(const FIntVector& SearchMin, const FIntVector& SearchMax, const FVoxelIslandEditShape& Shape, const FVoxelIslandDetectionSettings& Settings, FVoxelIslandScratch* Scratch = nullptr, FVoxelOccupancyPyramid* Pyramid = nullptr);
+	~FVoxelIslandDetectionJob();
+
+	// Returns true once the job has finished. Data must be the same world on every tick.
+	bool Tick(const FVoxelData& Data, double BudgetSeconds);
+
+	// Drops all progress and cached reads, e.g. after the searched region was edited
+	void Restart();
+
+	bool IsFinished() const { return bFinished; }
+	bool Overlaps(const FIntVector& Min, const FIntVector& Max) const;
+
+	TArray<FVoxelIsland> ConsumeIslands() { return MoveTemp(Islands); }
+
+	int32 GetNumTicks() const { return NumTicks; }
+	double GetTotalSeconds() const { return TotalSeconds; }
+
+private:
+	struct FState;
+
+	FIntVector SearchMin;
+	FIntVector SearchMax;
+	FVoxelIslandEditShape Shape;
+	FVoxelIslandDetectionSettings Settings;
+
+	TUniquePtr<FVoxelIslandScratch> OwnedScratch;
+	FVoxelIslandScratch* Scratch = nullptr;
+	FVoxelOccupancyPyramid* Pyramid = nullptr;
+
+	TUniquePtr<FState> State;
+	TArray<FVoxelIsland> Islands;
+	bool bFinished = false;
+	int32 NumTicks = 0;
+	double TotalSeconds = 0.0;
+};
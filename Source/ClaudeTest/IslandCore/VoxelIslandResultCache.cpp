@@ -0,0 +1,207 @@
+// VoxelIslandResultCache.cpp
+#include "VoxelIslandResultCache.h"
+#include "VoxelIsland.h"
+#include "VoxelOccupancyBuffer.h"
+#include "VoxelData/VoxelData.h"
+#include "VoxelData/VoxelDataIncludes.h"
+#include "VoxelIntBox.h"
+#include "Hash/CityHash.h"
+
+struct FVoxelIslandResultCache::FEntry
+{
+	TArray<FVoxelIslandEditSphere> Spheres;
+	uint32 SettingsHash = 0;
+	FIntVector ReadMin = FIntVector::ZeroValue;
+	FIntVector ReadMax = FIntVector::ZeroValue;
+	uint64 StartGeneration = 0;
+	TArray<FVoxelIsland> Islands;
+
+	bool Matches(const FVoxelIslandEditShape& Shape, uint32 InSettingsHash) const
+	{
+		if (SettingsHash != InSettingsHash || Spheres.Num() != Shape.Spheres.Num())
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < Spheres.Num(); Index++)
+		{
+			if (Spheres[Index].Center != Shape.Spheres[Index].Center || Spheres[Index].Radius != Shape.Spheres[Index].Radius)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+FVoxelIslandResultCache::FVoxelIslandResultCache() = default;
+FVoxelIslandResultCache::~FVoxelIslandResultCache() = default;
+
+void FVoxelIslandResultCache::SetChunkGeneration(const FIntVector& ChunkCoord)
+{
+	constexpr int32 ChunksPerRegionShift = RegionShift - ChunkShift;
+
+	ChunkGenerations.Add(ChunkCoord, Generation);
+	RegionGenerations.Add(FIntVector(ChunkCoord.X >> ChunksPerRegionShift, ChunkCoord.Y >> ChunksPerRegionShift, ChunkCoord.Z >> ChunksPerRegionShift), Generation);
+}
+
+void FVoxelIslandResultCache::MarkEdited(const FIntVector& Min, const FIntVector& Max)
+{
+	Generation++;
+
+	const FIntVector ChunkMin(Min.X >> ChunkShift, Min.Y >> ChunkShift, Min.Z >> ChunkShift);
+	const FIntVector ChunkMax(Max.X >> ChunkShift, Max.Y >> ChunkShift, Max.Z >> ChunkShift);
+	for (int32 Z = ChunkMin.Z; Z <= ChunkMax.Z; Z++)
+	{
+		for (int32 Y = ChunkMin.Y; Y <= ChunkMax.Y; Y++)
+		{
+			for (int32 X = ChunkMin.X; X <= ChunkMax.X; X++)
+			{
+				const FIntVector ChunkCoord(X, Y, Z);
+				SetChunkGeneration(ChunkCoord);
+
+				// The verified state is stale, so the next verification must not match it
+				ChunkHashes.Remove(ChunkCoord);
+			}
+		}
+	}
+}
+
+void FVoxelIslandResultCache::VerifyEdited(const FVoxelData& Data, const FIntVector& Min, const FIntVector& Max)
+{
+	const FIntVector ChunkMin(Min.X >> ChunkShift, Min.Y >> ChunkShift, Min.Z >> ChunkShift);
+	const FIntVector ChunkMax(Max.X >> ChunkShift, Max.Y >> ChunkShift, Max.Z >> ChunkShift);
+
+	FVoxelReadScopeLock Lock(Data, FVoxelIntBox(ChunkMin * ChunkSize, (ChunkMax + FIntVector(1)) * ChunkSize), "IslandResultCache");
+
+	FVoxelOccupancyBuffer Chunk;
+	bool bBumped = false;
+	for (int32 Z = ChunkMin.Z; Z <= ChunkMax.Z; Z++)
+	{
+		for (int32 Y = ChunkMin.Y; Y <= ChunkMax.Y; Y++)
+		{
+			for (int32 X = ChunkMin.X; X <= ChunkMax.X; X++)
+			{
+				const FIntVector ChunkCoord(X, Y, Z);
+				Chunk.ReadLocked(Data, ChunkCoord * ChunkSize, ChunkCoord * ChunkSize + FIntVector(ChunkSize - 1));
+
+				const TArray<uint64>& Words = Chunk.Solid.Words;
+				const uint64 Hash = CityHash64(reinterpret_cast<const char*>(Words.GetData()), Words.Num() * sizeof(uint64));
+
+				const uint64* OldHash = ChunkHashes.Find(ChunkCoord);
+				if (OldHash && *OldHash == Hash)
+				{
+					continue;
+				}
+
+				// Every chunk changed by this edit shares one new generation
+				if (!bBumped)
+				{
+					Generation++;
+					bBumped = true;
+				}
+				SetChunkGeneration(ChunkCoord);
+				ChunkHashes.Add(ChunkCoord, Hash);
+			}
+		}
+	}
+}
+
+bool FVoxelIslandResultCache::HasChangedSince(const FIntVector& Min, const FIntVector& Max, uint64 SinceGeneration) const
+{
+	constexpr int32 ChunksPerRegionShift = RegionShift - ChunkShift;
+
+	const FIntVector ChunkMin(Min.X >> ChunkShift, Min.Y >> ChunkShift, Min.Z >> ChunkShift);
+	const FIntVector ChunkMax(Max.X >> ChunkShift, Max.Y >> ChunkShift, Max.Z >> ChunkShift);
+	const FIntVector RegionMin(Min.X >> RegionShift, Min.Y >> RegionShift, Min.Z >> RegionShift);
+	const FIntVector RegionMax(Max.X >> RegionShift, Max.Y >> RegionShift, Max.Z >> RegionShift);
+
+	for (int32 RZ = RegionMin.Z; RZ <= RegionMax.Z; RZ++)
+	{
+		for (int32 RY = RegionMin.Y; RY <= RegionMax.Y; RY++)
+		{
+			for (int32 RX = RegionMin.X; RX <= RegionMax.X; RX++)
+			{
+				const uint64* RegionGeneration = RegionGenerations.Find(FIntVector(RX, RY, RZ));
+				if (!RegionGeneration || *RegionGeneration <= SinceGeneration)
+				{
+					continue;
+				}
+
+				// Something in this region changed - look at the chunks of the region inside the box
+				const FIntVector RegionChunkMin = FIntVector(RX, RY, RZ) * (1 << ChunksPerRegionShift);
+				const FIntVector RegionChunkMax = RegionChunkMin + FIntVector((1 << ChunksPerRegionShift) - 1);
+				for (int32 Z = FMath::Max(ChunkMin.Z, RegionChunkMin.Z); Z <= FMath::Min(ChunkMax.Z, RegionChunkMax.Z); Z++)
+				{
+					for (int32 Y = FMath::Max(ChunkMin.Y, RegionChunkMin.Y); Y <= FMath::Min(ChunkMax.Y, RegionChunkMax.Y); Y++)
+					{
+						for (int32 X = FMath::Max(ChunkMin.X, RegionChunkMin.X); X <= FMath::Min(ChunkMax.X, RegionChunkMax.X); X++)
+						{
+							const uint64* ChunkGeneration = ChunkGenerations.Find(FIntVector(X, Y, Z));
+							if (ChunkGeneration && *ChunkGeneration > SinceGeneration)
+							{
+								return true;
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+	return false;
+}
+
+const TArray<FVoxelIsland>* FVoxelIslandResultCache::Find(const FVoxelIslandEditShape& Shape, uint32 SettingsHash)
+{
+	for (int32 Index = Entries.Num() - 1; Index >= 0; Index--)
+	{
+		if (!Entries[Index]->Matches(Shape, SettingsHash))
+		{
+			continue;
+		}
+
+		if (HasChangedSince(Entries[Index]->ReadMin, Entries[Index]->ReadMax, Entries[Index]->StartGeneration))
+		{
+			Entries.RemoveAt(Index);
+			return nullptr;
+		}
+
+		// Move to the back so it is evicted last
+		TUniquePtr<FEntry> Entry = MoveTemp(Entries[Index]);
+		Entries.RemoveAt(Index);
+		return &Entries.Add_GetRef(MoveTemp(Entry))->Islands;
+	}
+	return nullptr;
+}
+
+void FVoxelIslandResultCache::Add(const FVoxelIslandEditShape& Shape, uint32 SettingsHash, const FIntVector& ReadMin, const FIntVector& ReadMax, uint64 StartGeneration, const TArray<FVoxelIsland>& Islands)
+{
+	// Edited while detecting - the result may mix data from before and after the edit
+	if (HasChangedSince(ReadMin, ReadMax, StartGeneration))
+	{
+		return;
+	}
+
+	for (int32 Index = 0; Index < Entries.Num(); Index++)
+	{
+		if (Entries[Index]->Matches(Shape, SettingsHash))
+		{
+			Entries.RemoveAt(Index);
+			break;
+		}
+	}
+
+	if (Entries.Num() >= MaxEntries)
+	{
+		Entries.RemoveAt(0);
+	}
+
+	TUniquePtr<FEntry> Entry = MakeUnique<FEntry>();
+	Entry->Spheres = Shape.Spheres;
+	Entry->SettingsHash = SettingsHash;
+	Entry->ReadMin = ReadMin;
+	Entry->ReadMax = ReadMax;
+	Entry->StartGeneration = StartGeneration;
+	Entry->Islands = Islands;
+	Entries.Add(MoveTemp(Entry));
+}
@@ -0,0 +1,65 @@
+// VoxelIslandResultCache.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelIslandDetection.h"
+
+class FVoxelData;
+struct FVoxelIsland;
+
+/**
+ * Edit generations per 16^3 chunk of one voxel world, plus the last few detection results keyed by edit
+ * shape and settings. A result stays valid while no chunk it read has a newer generation than the result,
+ * so repeating a check over an unchanged region returns without detecting again.
+ * Chunks with no generation have not been edited since the cache was created. Game thread only.
+ */
+class FVoxelIslandResultCache
+{
+public:
+	static constexpr int32 ChunkShift = 4;
+	static constexpr int32 ChunkSize = 1 << ChunkShift;
+
+	// Coarse generations over 256^3 regions, so validating a large box skips regions nobody edited
+	static constexpr int32 RegionShift = 8;
+
+	static constexpr int32 MaxEntries = 8;
+
+	FVoxelIslandResultCache();
+	~FVoxelIslandResultCache();
+
+	// Edits known to have changed voxels: every chunk overlapping the inclusive box gets a new generation
+	void MarkEdited(const FIntVector& Min, const FIntVector& Max);
+
+	// Edits that may have changed nothing, e.g. a dig into air: reads the chunks overlapping the box and only
+	// gives a new generation to chunks whose occupancy differs from the last time they were verified
+	void VerifyEdited(const FVoxelData& Data, const FIntVector& Min, const FIntVector& Max);
+
+	// Whether any chunk overlapping the inclusive box was edited after Generation
+	bool HasChangedSince(const FIntVector& Min, const FIntVector& Max, uint64 Generation) const;
+
+	uint64 GetGeneration() const { return Generation; }
+
+	// Result of an earlier detection with the same shape and settings whose region is unchanged since.
+	// Entries whose region changed are dropped.
+	const TArray<FVoxelIsland>* Find(const FVoxelIslandEditShape& Shape, uint32 SettingsHash);
+
+	// Records a detection that started at StartGeneration and read voxels inside the inclusive box
+	void Add(const FVoxelIslandEditShape& Shape, uint32 SettingsHash, const FIntVector& ReadMin, const FIntVector& ReadMax, uint64 StartGeneration, const TArray<FVoxelIsland>& Islands);
+
+	int32 GetNumEntries() const { return Entries.Num(); }
+
+private:
+	struct FEntry;
+
+	void SetChunkGeneration(const FIntVector& ChunkCoord);
+
+	uint64 Generation = 0;
+	TMap<FIntVector, uint64> ChunkGenerations;
+	TMap<FIntVector, uint64> RegionGenerations;
+
+	// Occupancy hash of chunks at their last VerifyEdited, dropped by MarkEdited
+	TMap<FIntVector, uint64> ChunkHashes;
+
+	// Most recently used last
+	TArray<TUniquePtr<FEntry>> Entries;
+};
@@ -0,0 +1,259 @@
+// VoxelIslandTransfer.cpp
+#include "VoxelIslandTransfer.h"
+#include "VoxelIsland.h"
+#include "VoxelData/VoxelData.h"
+#include "VoxelData/VoxelDataIncludes.h"
+#include "VoxelIntBox.h"
+#include "VoxelQueryZone.h"
+
+void FVoxelIslandTransfer::Read(const FVoxelData& Data, const FVoxelIsland& Island, const FIntVector& InDestMin)
+{
+	FVoxelReadScopeLock Lock(Data, FVoxelIntBox(Island.MinBounds, Island.MaxBounds + FIntVector(1)), "IslandTransferRead");
+	ReadLocked(Data, Island, InDestMin);
+}
+
+void FVoxelIslandTransfer::ReadLocked(const FVoxelData& Data, const FVoxelIsland& Island, const FIntVector& InDestMin)
+{
+	Reset();
+	if (Island.Voxels.Num() == 0)
+	{
+		return;
+	}
+
+	Offset = InDestMin - Island.MinBounds;
+	DestMin = InDestMin;
+	DestMax = Island.MaxBounds + Offset;
+
+	// Sort the island's voxels into destination chunks. Bricks are not aligned to those chunks unless the
+	// offset happens to be, so bits are placed one by one; consecutive bits nearly always share a chunk.
+	ChunkGridMin = FIntVector(DestMin.X >> ChunkShift, DestMin.Y >> ChunkShift, DestMin.Z >> ChunkShift);
+	ChunkGridSize = FIntVector(DestMax.X >> ChunkShift, DestMax.Y >> ChunkShift, DestMax.Z >> ChunkShift) - ChunkGridMin + FIntVector(1);
+	ChunkGrid.Init(INDEX_NONE, ChunkGridSize.X * ChunkGridSize.Y * ChunkGridSize.Z);
+
+	FIntVector LastChunkCoord(MAX_int32);
+	FChunk* LastChunk = nullptr;
+	Island.Voxels.ForEachBrick([&](const FIntVector& BrickMin, const uint64* Words)
+	{
+		for (int32 Slice = 0; Slice < FVoxelIslandVoxels::WordsPerBrick; Slice++)
+		{
+			for (uint64 Bits = Words[Slice]; Bits != 0; Bits &= Bits - 1)
+			{
+				const int32 Bit = int32(FMath::CountTrailingZeros64(Bits));
+				const FIntVector Pos = BrickMin + FIntVector(Bit & 7, Bit >> 3, Slice) + Offset;
+				const FIntVector ChunkCoord(Pos.X >> ChunkShift, Pos.Y >> ChunkShift, Pos.Z >> ChunkShift);
+				if (ChunkCoord != LastChunkCoord)
+				{
+					const FIntVector Cell = ChunkCoord - ChunkGridMin;
+					int32& ChunkIndex = ChunkGrid[Cell.X + ChunkGridSize.X * (Cell.Y + ChunkGridSize.Y * Cell.Z)];
+					if (ChunkIndex == INDEX_NONE)
+					{
+						ChunkIndex = Chunks.Num();
+						FChunk& NewChunk = Chunks.AddDefaulted_GetRef();
+						const FIntVector ChunkMin = ChunkCoord * ChunkSize;
+						NewChunk.Min = FIntVector(FMath::Max(ChunkMin.X, DestMin.X), FMath::Max(ChunkMin.Y, DestMin.Y), FMath::Max(ChunkMin.Z, DestMin.Z));
+						NewChunk.Max = FIntVector(FMath::Min(ChunkMin.X + ChunkSize - 1, DestMax.X), FMath::Min(ChunkMin.Y + ChunkSize - 1, DestMax.Y), FMath::Min(ChunkMin.Z + ChunkSize - 1, DestMax.Z));
+						const FIntVector Size = NewChunk.GetSize();
+						NewChunk.Mask.SetNumZeroed(FMath::DivideAndRoundUp(Size.X * Size.Y * Size.Z, 64));
+					}
+					LastChunkCoord = ChunkCoord;
+					LastChunk = &Chunks[ChunkIndex];
+				}
+
+				const int32 Index = LastChunk->GetIndex(Pos);
+				LastChunk->Mask[Index >> 6] |= uint64(1) << (Index & 63);
+				LastChunk->NumVoxels++;
+			}
+		}
+	});
+
+	// One bulk query per field and chunk, then clear whatever the boxes caught besides the island
+	for (FChunk& Chunk : Chunks)
+	{
+		const FIntVector Size = Chunk.GetSize();
+		const int32 Count = Size.X * Size.Y * Size.Z;
+		const FVoxelIntBox SourceBounds(Chunk.Min - Offset, Chunk.Max - Offset + FIntVector(1));
+
+		Chunk.Values.SetNumUninitialized(Count);
+		TVoxelQueryZone<FVoxelValue> ValueQuery(SourceBounds, Chunk.Values);
+		Data.Get<FVoxelValue>(ValueQuery, 0);
+
+		Chunk.Materials.SetNumUninitialized(Count);
+		TVoxelQueryZone<FVoxelMaterial> MaterialQuery(SourceBounds, Chunk.Materials);
+		Data.Get<FVoxelMaterial>(MaterialQuery, 0);
+
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			if (!Chunk.IsIslandVoxel(Index))
+			{
+				Chunk.Values[Index] = FVoxelValue::Empty();
+				Chunk.Materials[Index] = FVoxelMaterial::Default();
+			}
+		}
+
+		NumVoxels += Chunk.NumVoxels;
+	}
+}
+
+void FVoxelIslandTransfer::Write(FVoxelData& Data, bool bForceSolid) const
+{
+	if (Chunks.Num() == 0)
+	{
+		return;
+	}
+
+	FVoxelWriteScopeLock Lock(Data, FVoxelIntBox(DestMin, DestMax + FIntVector(1)), "IslandTransferWrite");
+
+	for (const FChunk& Chunk : Chunks)
+	{
+		const FVoxelIntBox Bounds(Chunk.Min, Chunk.Max + FIntVector(1));
+
+		Data.Set<FVoxelValue>(Bounds, [&](int32 X, int32 Y, int32 Z, FVoxelValue& Value)
+		{
+			const int32 Index = Chunk.GetIndex(FIntVector(X, Y, Z));
+			if (Chunk.IsIslandVoxel(Index))
+			{
+				Value = bForceSolid ? FVoxelValue::Full() : Chunk.Values[Index];
+			}
+		});
+
+		Data.Set<FVoxelMaterial>(Bounds, [&](int32 X, int32 Y, int32 Z, FVoxelMaterial& Material)
+		{
+			const int32 Index = Chunk.GetIndex(FIntVector(X, Y, Z));
+			if (Chunk.IsIslandVoxel(Index))
+			{
+				Material = Chunk.Materials[Index];
+			}
+		});
+	}
+}
+
+int32 FVoxelIslandTransfer::Erase(FVoxelData& Data, const FVoxelIsland& Island, FIntVector& OutDirtyMin, FIntVector& OutDirtyMax)
+{
+	OutDirtyMin = FIntVector(MAX_int32);
+	OutDirtyMax = FIntVector(MIN_int32);
+	if (Island.Voxels.Num() == 0)
+	{
+		return 0;
+	}
+
+	FVoxelWriteScopeLock Lock(Data, FVoxelIntBox(Island.MinBounds - FIntVector(1), Island.MaxBounds + FIntVector(2)), "IslandErase");
+
+	int32 NumBoxes = 0;
+	Island.Voxels.ForEachBox([&](const FIntVector& Min, const FIntVector& Max, const uint64* Words)
+	{
+		const FVoxelIntBox Bounds(Min, Max + FIntVector(1));
+		if (!Words)
+		{
+			Data.Set<FVoxelValue>(Bounds, [](int32 X, int32 Y, int32 Z, FVoxelValue& Value)
+			{
+				Value = FVoxelValue::Empty();
+			});
+			Data.Set<FVoxelMaterial>(Bounds, [](int32 X, int32 Y, int32 Z, FVoxelMaterial& Material)
+			{
+				Material = FVoxelMaterial::Default();
+			});
+		}
+		else
+		{
+			const FIntVector BrickMin = FIntVector(Min.X >> FVoxelIslandVoxels::BrickShift, Min.Y >> FVoxelIslandVoxels::BrickShift, Min.Z >> FVoxelIslandVoxels::BrickShift) * FVoxelIslandVoxels::BrickSize;
+			auto IsIslandVoxel = [&](int32 X, int32 Y, int32 Z)
+			{
+				return (Words[Z - BrickMin.Z] >> ((Y - BrickMin.Y) * FVoxelIslandVoxels::BrickSize + X - BrickMin.X)) & 1;
+			};
+			Data.Set<FVoxelValue>(Bounds, [&](int32 X, int32 Y, int32 Z, FVoxelValue& Value)
+			{
+				if (IsIslandVoxel(X, Y, Z))
+				{
+					Value = FVoxelValue::Empty();
+				}
+			});
+			Data.Set<FVoxelMaterial>(Bounds, [&](int32 X, int32 Y, int32 Z, FVoxelMaterial& Material)
+			{
+				if (IsIslandVoxel(X, Y, Z))
+				{
+					Material = FVoxelMaterial::Default();
+				}
+			});
+		}
+
+		OutDirtyMin = FIntVector(FMath::Min(OutDirtyMin.X, Min.X), FMath::Min(OutDirtyMin.Y, Min.Y), FMath::Min(OutDirtyMin.Z, Min.Z));
+		OutDirtyMax = FIntVector(FMath::Max(OutDirtyMax.X, Max.X), FMath::Max(OutDirtyMax.Y, Max.Y), FMath::Max(OutDirtyMax.Z, Max.Z));
+		NumBoxes++;
+	});
+	return NumBoxes;
+}
+
+FVoxelValue FVoxelIslandTransfer::GetValue(const FIntVector& Pos) const
+{
+	const FChunk* Chunk = FindChunk(Pos);
+	return Chunk ? Chunk->Values[Chunk->GetIndex(Pos)] : FVoxelValue::Empty();
+}
+
+FVoxelMaterial FVoxelIslandTransfer::GetMaterial(const FIntVector& Pos) const
+{
+	const FChunk* Chunk = FindChunk(Pos);
+	return Chunk ? Chunk->Materials[Chunk->GetIndex(Pos)] : FVoxelMaterial::Default();
+}
+
+bool FVoxelIslandTransfer::Intersects(const FIntVector& Min, const FIntVector& Max) const
+{
+	if (Chunks.Num() == 0 ||
+		Max.X < DestMin.X || Max.Y < DestMin.Y || Max.Z < DestMin.Z ||
+		Min.X > DestMax.X || Min.Y > DestMax.Y || Min.Z > DestMax.Z)
+	{
+		return false;
+	}
+
+	const FIntVector CellMin = FIntVector(FMath::Max(Min.X, DestMin.X) >> ChunkShift, FMath::Max(Min.Y, DestMin.Y) >> ChunkShift, FMath::Max(Min.Z, DestMin.Z) >> ChunkShift) - ChunkGridMin;
+	const FIntVector CellMax = FIntVector(FMath::Min(Max.X, DestMax.X) >> ChunkShift, FMath::Min(Max.Y, DestMax.Y) >> ChunkShift, FMath::Min(Max.Z, DestMax.Z) >> ChunkShift) - ChunkGridMin;
+	for (int32 Z = CellMin.Z; Z <= CellMax.Z; Z++)
+	{
+		for (int32 Y = CellMin.Y; Y <= CellMax.Y; Y++)
+		{
+			for (int32 X = CellMin.X; X <= CellMax.X; X++)
+			{
+				if (ChunkGrid[X + ChunkGridSize.X * (Y + ChunkGridSize.Y * Z)] != INDEX_NONE)
+				{
+					return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+const FVoxelIslandTransfer::FChunk* FVoxelIslandTransfer::FindChunk(const FIntVector& Pos) const
+{
+	if (Chunks.Num() == 0 ||
+		Pos.X < DestMin.X || Pos.Y < DestMin.Y || Pos.Z < DestMin.Z ||
+		Pos.X > DestMax.X || Pos.Y > DestMax.Y || Pos.Z > DestMax.Z)
+	{
+		return nullptr;
+	}
+
+	const FIntVector Cell = FIntVector(Pos.X >> ChunkShift, Pos.Y >> ChunkShift, Pos.Z >> ChunkShift) - ChunkGridMin;
+	const int32 ChunkIndex = ChunkGrid[Cell.X + ChunkGridSize.X * (Cell.Y + ChunkGridSize.Y * Cell.Z)];
+	return ChunkIndex != INDEX_NONE ? &Chunks[ChunkIndex] : nullptr;
+}
+
+void FVoxelIslandTransfer::Reset()
+{
+	Chunks.Reset();
+	ChunkGrid.Reset();
+	ChunkGridMin = FIntVector::ZeroValue;
+	ChunkGridSize = FIntVector::ZeroValue;
+	Offset = FIntVector::ZeroValue;
+	DestMin = FIntVector::ZeroValue;
+	DestMax = FIntVector::ZeroValue;
+	NumVoxels = 0;
+}
+
+int64 FVoxelIslandTransfer::GetAllocatedSize() const
+{
+	int64 Size = Chunks.GetAllocatedSize() + ChunkGrid.GetAllocatedSize();
+	for (const FChunk& Chunk : Chunks)
+	{
+		Size += Chunk.Values.GetAllocatedSize() + Chunk.Materials.GetAllocatedSize() + Chunk.Mask.GetAllocatedSize();
+	}
+	return Size;
+}
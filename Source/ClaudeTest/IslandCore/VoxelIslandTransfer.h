@@ -0,0 +1,104 @@
+// VoxelIslandTransfer.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelValue.h"
+#include "VoxelMaterial.h"
+
+class FVoxelData;
+struct FVoxelIsland;
+
+/**
+ * Island voxel data moved between worlds one 16^3 data chunk at a time instead of one voxel at a time.
+ * Chunks follow the destination's chunk grid, so each one is a single bulk write there; its source box is
+ * read with a single bulk query. Values and materials outside the island are masked out, so the chunks
+ * hold exactly the island. Locks cover the island bounds only, never the whole world.
+ * Once read, a transfer is immutable and can also be sampled voxel by voxel, which lets a falling world
+ * use it as its read-only base data instead of receiving a copy.
+ */
+class FVoxelIslandTransfer
+{
+public:
+	static constexpr int32 ChunkShift = 4;
+	static constexpr int32 ChunkSize = 1 << ChunkShift;
+
+	// Part of one destination chunk covered by the island's rebased bounds
+	struct FChunk
+	{
+		// Inclusive, destination voxel coordinates
+		FIntVector Min = FIntVector::ZeroValue;
+		FIntVector Max = FIntVector::ZeroValue;
+
+		// X fastest over the box; empty value and default material where the box is not island
+		TArray<FVoxelValue> Values;
+		TArray<FVoxelMaterial> Materials;
+
+		// One bit per entry of Values, set for island voxels
+		TArray<uint64> Mask;
+
+		int32 NumVoxels = 0;
+
+		FIntVector GetSize() const { return Max - Min + FIntVector(1); }
+
+		FORCEINLINE bool IsIslandVoxel(int32 Index) const
+		{
+			return (Mask[Index >> 6] >> (Index & 63)) & 1;
+		}
+
+		FORCEINLINE int32 GetIndex(const FIntVector& Pos) const
+		{
+			const FIntVector Size = GetSize();
+			const FIntVector Local = Pos - Min;
+			return Local.X + Size.X * (Local.Y + Size.Y * Local.Z);
+		}
+	};
+
+	// Takes a read lock over the island bounds and reads the island, rebased so MinBounds lands on DestMin
+	void Read(const FVoxelData& Data, const FVoxelIsland& Island, const FIntVector& DestMin);
+
+	// Same as Read for callers that already hold a read lock covering the island bounds
+	void ReadLocked(const FVoxelData& Data, const FVoxelIsland& Island, const FIntVector& DestMin);
+
+	// Takes a write lock over the rebased island bounds and writes every chunk with one bulk write per field,
+	// touching island voxels only. bForceSolid writes full density instead of the source values.
+	void Write(FVoxelData& Data, bool bForceSolid = false) const;
+
+	// Clears the island out of Data under a write lock over its bounds padded by one voxel: runs of full
+	// bricks with plain box writes, every other brick with one masked box write. Returns the number of boxes;
+	// OutDirtyMin/Max receive the inclusive region written, for the render and collision update.
+	static int32 Erase(FVoxelData& Data, const FVoxelIsland& Island, FIntVector& OutDirtyMin, FIntVector& OutDirtyMax);
+
+	void Reset();
+
+	const TArray<FChunk>& GetChunks() const { return Chunks; }
+	int32 GetNumVoxels() const { return NumVoxels; }
+
+	// Inclusive rebased island bounds
+	const FIntVector& GetDestMin() const { return DestMin; }
+	const FIntVector& GetDestMax() const { return DestMax; }
+
+	// Rebased island value and material, empty and default outside the island
+	FVoxelValue GetValue(const FIntVector& Pos) const;
+	FVoxelMaterial GetMaterial(const FIntVector& Pos) const;
+
+	// Whether any chunk overlaps the inclusive destination box
+	bool Intersects(const FIntVector& Min, const FIntVector& Max) const;
+
+	int64 GetAllocatedSize() const;
+
+private:
+	TArray<FChunk> Chunks;
+
+	// Index into Chunks per destination chunk over the rebased bounds, X fastest; INDEX_NONE where empty
+	TArray<int32> ChunkGrid;
+	FIntVector ChunkGridMin = FIntVector::ZeroValue;
+	FIntVector ChunkGridSize = FIntVector::ZeroValue;
+
+	// Destination minus source position
+	FIntVector Offset = FIntVector::ZeroValue;
+	FIntVector DestMin = FIntVector::ZeroValue;
+	FIntVector DestMax = FIntVector::ZeroValue;
+	int32 NumVoxels = 0;
+
+	const FChunk* FindChunk(const FIntVector& Pos) const;
+};
@@ -0,0 +1,194 @@
+// VoxelIslandVoxels.cpp
+#include "VoxelIslandVoxels.h"
+
+void FVoxelIslandVoxels::Assign(TArray<FIntVector> Positions)
+{
+	Reset();
+
+	// Sorting by brick groups each brick's voxels together, so bricks are emitted in storage order
+	Positions.Sort([](const FIntVector& A, const FIntVector& B)
+	{
+		return BrickLess(GetBrickCoord(A), GetBrickCoord(B));
+	});
+
+	for (const FIntVector& Pos : Positions)
+	{
+		const FIntVector BrickCoord = GetBrickCoord(Pos);
+		if (BrickCoords.Num() == 0 || BrickCoords.Last() != BrickCoord)
+		{
+			BrickCoords.Add(BrickCoord);
+			BrickWords.AddZeroed(WordsPerBrick);
+		}
+
+		uint64& Word = BrickWords[(BrickCoords.Num() - 1) * WordsPerBrick + (Pos.Z & (BrickSize - 1))];
+		const uint64 Mask = uint64(1) << ((Pos.Y & (BrickSize - 1)) * BrickSize + (Pos.X & (BrickSize - 1)));
+		if ((Word & Mask) == 0)
+		{
+			Word |= Mask;
+			NumVoxels++;
+		}
+	}
+
+	BrickCoords.Shrink();
+	BrickWords.Shrink();
+}
+
+int32 FVoxelIslandVoxels::FindBrick(const FIntVector& BrickCoord) const
+{
+	int32 Low = 0;
+	int32 High = BrickCoords.Num();
+	while (Low < High)
+	{
+		const int32 Mid = (Low + High) / 2;
+		if (BrickLess(BrickCoords[Mid], BrickCoord))
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+	return Low < BrickCoords.Num() && BrickCoords[Low] == BrickCoord ? Low : INDEX_NONE;
+}
+
+bool FVoxelIslandVoxels::Contains(const FIntVector& Pos) const
+{
+	const int32 Brick = FindBrick(GetBrickCoord(Pos));
+	if (Brick == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const uint64 Word = BrickWords[Brick * WordsPerBrick + (Pos.Z & (BrickSize - 1))];
+	return (Word >> ((Pos.Y & (BrickSize - 1)) * BrickSize + (Pos.X & (BrickSize - 1)))) & 1;
+}
+
+FVoxelIslandStats FVoxelIslandVoxels::ComputeStats() const
+{
+	FVoxelIslandStats Stats;
+	if (NumVoxels == 0)
+	{
+		return Stats;
+	}
+
+	// Bits whose local X (resp. Y) coordinate has bit I set
+	static constexpr uint64 XBitMasks[3] = { 0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull };
+	static constexpr uint64 YBitMasks[3] = { 0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull };
+
+	// Sums are taken relative to the first brick so the centered moments keep their precision far from the origin
+	const FIntVector Origin = BrickCoords[0] * BrickSize;
+
+	FIntVector Min(MAX_int32);
+	FIntVector Max(MIN_int32);
+	double Sum[3] = {};
+	double SumSq[3] = {};
+	double SumXY = 0.0;
+	double SumXZ = 0.0;
+	double SumYZ = 0.0;
+
+	ForEachBrick([&](const FIntVector& BrickMin, const uint64* Words)
+	{
+		const FIntVector Local = BrickMin - Origin;
+		uint64 Columns = 0;
+
+		for (int32 Slice = 0; Slice < WordsPerBrick; Slice++)
+		{
+			const uint64 Word = Words[Slice];
+			if (Word == 0)
+			{
+				continue;
+			}
+			Columns |= Word;
+			Min.Z = FMath::Min(Min.Z, BrickMin.Z + Slice);
+			Max.Z = FMath::Max(Max.Z, BrickMin.Z + Slice);
+
+			// Sums of x, y, x^2, y^2 and x*y over the set bits from popcounts of the coordinate bit planes:
+			// x = sum_i 2^i x_i, so x^2 = sum_ij 2^(i+j) x_i x_j and each x_i x_j is a masked popcount
+			const double Count = double(FMath::CountBits(Word));
+			int64 SX = 0;
+			int64 SY = 0;
+			int64 SXX = 0;
+			int64 SYY = 0;
+			int64 SXY = 0;
+			for (int32 I = 0; I < 3; I++)
+			{
+				const uint64 XI = Word & XBitMasks[I];
+				const uint64 YI = Word & YBitMasks[I];
+				SX += int64(FMath::CountBits(XI)) << I;
+				SY += int64(FMath::CountBits(YI)) << I;
+				for (int32 J = 0; J < 3; J++)
+				{
+					SXX += int64(FMath::CountBits(XI & XBitMasks[J])) << (I + J);
+					SYY += int64(FMath::CountBits(YI & YBitMasks[J])) << (I + J);
+					SXY += int64(FMath::CountBits(XI & YBitMasks[J])) << (I + J);
+				}
+			}
+
+			// Shift the local sums to the brick's offset from Origin
+			const double BX = Local.X;
+			const double BY = Local.Y;
+			const double Z = Local.Z + Slice;
+			const double WX = BX * Count + double(SX);
+			const double WY = BY * Count + double(SY);
+
+			Sum[0] += WX;
+			Sum[1] += WY;
+			Sum[2] += Z * Count;
+			SumSq[0] += BX * BX * Count + 2.0 * BX * double(SX) + double(SXX);
+			SumSq[1] += BY * BY * Count + 2.0 * BY * double(SY) + double(SYY);
+			SumSq[2] += Z * Z * Count;
+			SumXY += BX * BY * Count + BX * double(SY) + BY * double(SX) + double(SXY);
+			SumXZ += Z * WX;
+			SumYZ += Z * WY;
+		}
+
+		// Collapse the brick to X/Y column masks before touching individual bits
+		uint32 XMask = 0;
+		uint32 YMask = 0;
+		for (int32 Y = 0; Y < BrickSize; Y++)
+		{
+			const uint32 Row = uint32((Columns >> (Y * BrickSize)) & 0xFF);
+			XMask |= Row;
+			YMask |= Row != 0 ? 1u << Y : 0u;
+		}
+
+		Min.X = FMath::Min(Min.X, BrickMin.X + int32(FMath::CountTrailingZeros(XMask)));
+		Min.Y = FMath::Min(Min.Y, BrickMin.Y + int32(FMath::CountTrailingZeros(YMask)));
+		Max.X = FMath::Max(Max.X, BrickMin.X + 31 - int32(FMath::CountLeadingZeros(XMask)));
+		Max.Y = FMath::Max(Max.Y, BrickMin.Y + 31 - int32(FMath::CountLeadingZeros(YMask)));
+	});
+
+	const double N = NumVoxels;
+	const FVector Mean(Sum[0] / N, Sum[1] / N, Sum[2] / N);
+
+	// Second moments about the centroid
+	const double CXX = SumSq[0] - N * Mean.X * Mean.X;
+	const double CYY = SumSq[1] - N * Mean.Y * Mean.Y;
+	const double CZZ = SumSq[2] - N * Mean.Z * Mean.Z;
+	const double CXY = SumXY - N * Mean.X * Mean.Y;
+	const double CXZ = SumXZ - N * Mean.X * Mean.Z;
+	const double CYZ = SumYZ - N * Mean.Y * Mean.Z;
+
+	// A unit cube adds 1/6 about each of its own axes
+	const double CubeInertia = N / 6.0;
+
+	Stats.NumVoxels = NumVoxels;
+	Stats.Min = Min;
+	Stats.Max = Max;
+	Stats.Centroid = FVector(Origin) + Mean;
+	Stats.InertiaDiagonal = FVector(CYY + CZZ + CubeInertia, CXX + CZZ + CubeInertia, CXX + CYY + CubeInertia);
+	Stats.InertiaProducts = FVector(-CXY, -CXZ, -CYZ);
+	return Stats;
+}
+
+TArray<FIntVector> FVoxelIslandVoxels::ToArray() const
+{
+	TArray<FIntVector> Positions;
+	Positions.Reserve(NumVoxels);
+	for (const FIntVector Pos : *this)
+	{
+		Positions.Add(Pos);
+	}
+	return Positions;
+}
@@ -0,0 +1,249 @@
+// VoxelIslandVoxels.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Shape statistics of a voxel set, gathered in one pass over its packed bricks
+struct FVoxelIslandStats
+{
+	int32 NumVoxels = 0;
+
+	// Inclusive
+	FIntVector Min = FIntVector::ZeroValue;
+	FIntVector Max = FIntVector::ZeroValue;
+
+	FVector Centroid = FVector::ZeroVector;
+
+	// Inertia tensor about the centroid in voxel units, each voxel a unit cube of unit mass:
+	// (Ixx, Iyy, Izz) and the products (Ixy, Ixz, Iyz). Scale by voxel mass * VoxelSize^2 for world units.
+	FVector InertiaDiagonal = FVector::ZeroVector;
+	FVector InertiaProducts = FVector::ZeroVector;
+};
+
+/**
+ * Compact voxel set for a detected island: one 8x8x8 occupancy mask (eight 64-bit words, one per Z slice,
+ * bit = Y * 8 + X, same layout as FVoxelIslandBitGrid) per touched world-aligned brick. Bricks are sorted
+ * Z, then Y, then X, so iterating streams through contiguous memory in the order chunk copies want.
+ * A solid 10k-voxel island takes about 2 KB instead of 120 KB as TArray<FIntVector>.
+ */
+class FVoxelIslandVoxels
+{
+public:
+	static constexpr int32 BrickShift = 3;
+	static constexpr int32 BrickSize = 1 << BrickShift;
+	static constexpr int32 WordsPerBrick = 8;
+
+	FVoxelIslandVoxels() = default;
+
+	explicit FVoxelIslandVoxels(TArray<FIntVector> Positions)
+	{
+		Assign(MoveTemp(Positions));
+	}
+
+	// Replaces the set; duplicate positions are stored once
+	void Assign(TArray<FIntVector> Positions);
+
+	void Reset()
+	{
+		BrickCoords.Reset();
+		BrickWords.Reset();
+		NumVoxels = 0;
+	}
+
+	int32 Num() const { return NumVoxels; }
+	int32 NumBricks() const { return BrickCoords.Num(); }
+
+	bool Contains(const FIntVector& Pos) const;
+
+	// Bounds, centroid and inertia in one walk over the bricks, counting bits per slice word instead of
+	// visiting voxels. All zero for an empty set.
+	FVoxelIslandStats ComputeStats() const;
+
+	TArray<FIntVector> ToArray() const;
+
+	int64 GetAllocatedSize() const
+	{
+		return BrickCoords.GetAllocatedSize() + BrickWords.GetAllocatedSize();
+	}
+
+	// Visit(BrickMin, Words) once per brick, in storage order
+	template<typename TVisit>
+	void ForEachBrick(TVisit&& Visit) const
+	{
+		for (int32 Brick = 0; Brick < BrickCoords.Num(); Brick++)
+		{
+			Visit(BrickCoords[Brick] * BrickSize, &BrickWords[Brick * WordsPerBrick]);
+		}
+	}
+
+	// Visit(Min, Max, Words) over inclusive boxes that together cover the set exactly, for box-level edits.
+	// Runs of full bricks along X come as one box with null Words; any other brick comes as its tight bounds
+	// with its words, which tell the voxels of the box that are in the set.
+	template<typename TVisit>
+	void ForEachBox(TVisit&& Visit) const
+	{
+		int32 RunStart = INDEX_NONE;
+		auto FlushRun = [&](int32 RunEnd)
+		{
+			Visit(BrickCoords[RunStart] * BrickSize, BrickCoords[RunEnd] * BrickSize + FIntVector(BrickSize - 1), nullptr);
+			RunStart = INDEX_NONE;
+		};
+
+		for (int32 Brick = 0; Brick < BrickCoords.Num(); Brick++)
+		{
+			const uint64* Words = &BrickWords[Brick * WordsPerBrick];
+
+			uint64 Full = ~uint64(0);
+			uint64 Columns = 0;
+			int32 MinZ = WordsPerBrick;
+			int32 MaxZ = -1;
+			for (int32 Slice = 0; Slice < WordsPerBrick; Slice++)
+			{
+				Full &= Words[Slice];
+				if (Words[Slice] != 0)
+				{
+					Columns |= Words[Slice];
+					MinZ = FMath::Min(MinZ, Slice);
+					MaxZ = Slice;
+				}
+			}
+
+			if (Full == ~uint64(0))
+			{
+				if (RunStart != INDEX_NONE && BrickCoords[Brick] != BrickCoords[Brick - 1] + FIntVector(1, 0, 0))
+				{
+					FlushRun(Brick - 1);
+				}
+				if (RunStart == INDEX_NONE)
+				{
+					RunStart = Brick;
+				}
+				continue;
+			}
+
+			if (RunStart != INDEX_NONE)
+			{
+				FlushRun(Brick - 1);
+			}
+			if (MaxZ < 0)
+			{
+				continue;
+			}
+
+			uint32 Rows = 0;
+			int32 MinY = BrickSize;
+			int32 MaxY = -1;
+			for (int32 Y = 0; Y < BrickSize; Y++)
+			{
+				const uint32 Row = uint32(Columns >> (Y * BrickSize)) & 0xff;
+				if (Row != 0)
+				{
+					Rows |= Row;
+					MinY = FMath::Min(MinY, Y);
+					MaxY = Y;
+				}
+			}
+
+			const FIntVector BrickMin = BrickCoords[Brick] * BrickSize;
+			const int32 MinX = int32(FMath::CountTrailingZeros(Rows));
+			const int32 MaxX = 31 - int32(FMath::CountLeadingZeros(Rows));
+			Visit(BrickMin + FIntVector(MinX, MinY, MinZ), BrickMin + FIntVector(MaxX, MaxY, MaxZ), Words);
+		}
+
+		if (RunStart != INDEX_NONE)
+		{
+			FlushRun(BrickCoords.Num() - 1);
+		}
+	}
+
+	// Walks set bits brick by brick; yields positions by value
+	class FIterator
+	{
+	public:
+		FIterator(const FVoxelIslandVoxels& InSet, int32 InBrick)
+			: Set(InSet)
+			, Brick(InBrick)
+		{
+			LoadBrick();
+		}
+
+		FIntVector operator*() const
+		{
+			const int32 Bit = int32(FMath::CountTrailingZeros64(Bits));
+			return BrickMin + FIntVector(Bit & 7, Bit >> 3, Slice);
+		}
+
+		FIterator& operator++()
+		{
+			Bits &= Bits - 1;
+			Advance();
+			return *this;
+		}
+
+		bool operator!=(const FIterator& Other) const
+		{
+			return Brick != Other.Brick || Slice != Other.Slice || Bits != Other.Bits;
+		}
+
+	private:
+		void LoadBrick()
+		{
+			Slice = 0;
+			Bits = 0;
+			if (Brick < Set.BrickCoords.Num())
+			{
+				BrickMin = Set.BrickCoords[Brick] * BrickSize;
+				Bits = Set.BrickWords[Brick * WordsPerBrick];
+				Advance();
+			}
+		}
+
+		// Moves to the next set bit at or after the current position
+		void Advance()
+		{
+			while (Bits == 0)
+			{
+				if (++Slice < WordsPerBrick)
+				{
+					Bits = Set.BrickWords[Brick * WordsPerBrick + Slice];
+					continue;
+				}
+
+				if (++Brick >= Set.BrickCoords.Num())
+				{
+					Slice = 0;
+					return;
+				}
+				BrickMin = Set.BrickCoords[Brick] * BrickSize;
+				Slice = 0;
+				Bits = Set.BrickWords[Brick * WordsPerBrick];
+			}
+		}
+
+		const FVoxelIslandVoxels& Set;
+		int32 Brick = 0;
+		int32 Slice = 0;
+		uint64 Bits = 0;
+		FIntVector BrickMin = FIntVector::ZeroValue;
+	};
+
+	FIterator begin() const { return FIterator(*this, 0); }
+	FIterator end() const { return FIterator(*this, BrickCoords.Num()); }
+
+private:
+	static FORCEINLINE FIntVector GetBrickCoord(const FIntVector& Pos)
+	{
+		return FIntVector(Pos.X >> BrickShift, Pos.Y >> BrickShift, Pos.Z >> BrickShift);
+	}
+
+	static FORCEINLINE bool BrickLess(const FIntVector& A, const FIntVector& B)
+	{
+		return A.Z != B.Z ? A.Z < B.Z : (A.Y != B.Y ? A.Y < B.Y : A.X < B.X);
+	}
+
+	int32 FindBrick(const FIntVector& BrickCoord) const;
+
+	TArray<FIntVector> BrickCoords;
+	TArray<uint64> BrickWords;
+	int32 NumVoxels = 0;
+};
@@ -0,0 +1,77 @@
+// VoxelOccupancyBuffer.cpp
+#include "VoxelOccupancyBuffer.h"
+#include "VoxelData/VoxelData.h"
+#include "VoxelData/VoxelDataIncludes.h"
+#include "VoxelIntBox.h"
+#include "VoxelQueryZone.h"
+
+void FVoxelOccupancyBuffer::Read(const FVoxelData& Data, const FIntVector& InMin, const FIntVector& InMax, EVoxelOccupancyFields Fields)
+{
+	FVoxelReadScopeLock Lock(Data, FVoxelIntBox(InMin, InMax + FIntVector(1)), "OccupancyRead");
+	ReadLocked(Data, InMin, InMax, Fields);
+}
+
+void FVoxelOccupancyBuffer::ReadLocked(const FVoxelData& Data, const FIntVector& InMin, const FIntVector& InMax, EVoxelOccupancyFields Fields)
+{
+	Size = InMax - InMin + FIntVector(1);
+	Solid.Init(InMin, InMax);
+
+	const FVoxelIntBox Bounds(InMin, InMax + FIntVector(1));
+	const int32 Count = Size.X * Size.Y * Size.Z;
+
+	// One octree walk for the whole box instead of one per voxel. The query writes into our own arrays,
+	// so a buffer that is read again keeps its allocations.
+	Values.SetNumUninitialized(Count, EAllowShrinking::No);
+	TVoxelQueryZone<FVoxelValue> ValueQuery(Bounds, Values);
+	Data.Get<FVoxelValue>(ValueQuery, 0);
+
+	int32 Index = 0;
+	for (int32 Z = InMin.Z; Z <= InMax.Z; Z++)
+	{
+		for (int32 Y = InMin.Y; Y <= InMax.Y; Y++)
+		{
+			for (int32 X = InMin.X; X <= InMax.X; X++, Index++)
+			{
+				if (!Values[Index].IsEmpty())
+				{
+					Solid.Set(FIntVector(X, Y, Z));
+				}
+			}
+		}
+	}
+
+	// Reset keeps the memory for the next read
+	if (!EnumHasAnyFlags(Fields, EVoxelOccupancyFields::Values))
+	{
+		Values.Reset();
+	}
+
+	if (EnumHasAnyFlags(Fields, EVoxelOccupancyFields::Materials))
+	{
+		Materials.SetNumUninitialized(Count, EAllowShrinking::No);
+		TVoxelQueryZone<FVoxelMaterial> MaterialQuery(Bounds, Materials);
+		Data.Get<FVoxelMaterial>(MaterialQuery, 0);
+	}
+	else
+	{
+		Materials.Reset();
+	}
+}
+
+void FVoxelOccupancyBuffer::Fill(const FIntVector& InMin, const FIntVector& InMax, bool bSolid)
+{
+	Size = InMax - InMin + FIntVector(1);
+	Solid.Init(InMin, InMax);
+	if (bSolid)
+	{
+		Solid.SetAll();
+	}
+
+	Values.Reset();
+	Materials.Reset();
+}
+
+int64 FVoxelOccupancyBuffer::CountSolid() const
+{
+	return Solid.CountSet();
+}
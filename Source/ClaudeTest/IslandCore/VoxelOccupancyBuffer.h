@@ -0,0 +1,78 @@
+// VoxelOccupancyBuffer.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelValue.h"
+#include "VoxelMaterial.h"
+#include "VoxelIslandBitGrid.h"
+
+class FVoxelData;
+
+// Extra per-voxel data to keep next to the occupancy bits
+enum class EVoxelOccupancyFields : uint8
+{
+	None = 0,
+	Values = 1 << 0,
+	Materials = 1 << 1
+};
+ENUM_CLASS_FLAGS(EVoxelOccupancyFields)
+
+/**
+ * Box of voxel data read in bulk under a single lock.
+ * Occupancy is always packed into a bit grid; dense values and materials are kept only when requested.
+ * Island detection and diagnostics query this instead of calling FVoxelData::GetValue per voxel.
+ */
+struct FVoxelOccupancyBuffer
+{
+	// Takes a read lock over the inclusive box and reads it
+	void Read(const FVoxelData& Data, const FIntVector& InMin, const FIntVector& InMax, EVoxelOccupancyFields Fields = EVoxelOccupancyFields::None);
+
+	// Same as Read for callers that already hold a read lock covering the box
+	void ReadLocked(const FVoxelData& Data, const FIntVector& InMin, const FIntVector& InMax, EVoxelOccupancyFields Fields = EVoxelOccupancyFields::None);
+
+	// Initializes the box as all empty or all solid without reading, for boxes known to be uniform
+	void Fill(const FIntVector& InMin, const FIntVector& InMax, bool bSolid);
+
+	FORCEINLINE bool Contains(const FIntVector& Pos) const
+	{
+		return Solid.Contains(Pos);
+	}
+
+	// Position must be inside the box
+	FORCEINLINE bool IsSolid(const FIntVector& Pos) const
+	{
+		return Solid.Get(Pos);
+	}
+
+	// Only valid when read with EVoxelOccupancyFields::Values
+	FORCEINLINE const FVoxelValue& GetValue(const FIntVector& Pos) const
+	{
+		return Values[GetDenseIndex(Pos)];
+	}
+
+	// Only valid when read with EVoxelOccupancyFields::Materials
+	FORCEINLINE const FVoxelMaterial& GetMaterial(const FIntVector& Pos) const
+	{
+		return Materials[GetDenseIndex(Pos)];
+	}
+
+	int64 CountSolid() const;
+
+	const FIntVector& GetMin() const { return Solid.Min; }
+	const FIntVector& GetMax() const { return Solid.Max; }
+
+	FVoxelIslandBitGrid Solid;
+
+	// X fastest, same layout as FVoxelData::Get
+	TArray<FVoxelValue> Values;
+	TArray<FVoxelMaterial> Materials;
+
+private:
+	FORCEINLINE int32 GetDenseIndex(const FIntVector& Pos) const
+	{
+		const FIntVector Local = Pos - Solid.Min;
+		return Local.X + Size.X * (Local.Y + Size.Y * Local.Z);
+	}
+
+	FIntVector Size = FIntVector::ZeroValue;
+};
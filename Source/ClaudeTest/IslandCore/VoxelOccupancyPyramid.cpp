@@ -0,0 +1,103 @@
+// VoxelOccupancyPyramid.cpp
+#include "VoxelOccupancyPyramid.h"
+
+void FVoxelOccupancyPyramid::SetCellState(const FIntVector& CellCoord, EVoxelOccupancyState State)
+{
+	if (State == EVoxelOccupancyState::Unknown)
+	{
+		Levels[0].Remove(CellCoord);
+	}
+	else
+	{
+		Levels[0].Add(CellCoord, State);
+	}
+
+	// A parent is uniform only if all eight children are known and agree
+	FIntVector NodeCoord = CellCoord;
+	for (int32 Level = 1; Level < NumLevels; Level++)
+	{
+		const FIntVector ChildBase(NodeCoord.X & ~1, NodeCoord.Y & ~1, NodeCoord.Z & ~1);
+		NodeCoord = FIntVector(NodeCoord.X >> 1, NodeCoord.Y >> 1, NodeCoord.Z >> 1);
+
+		int32 NumEmpty = 0;
+		int32 NumFull = 0;
+		bool bMixed = false;
+		for (int32 Child = 0; Child < 8; Child++)
+		{
+			switch (GetState(Level - 1, ChildBase + FIntVector(Child & 1, (Child >> 1) & 1, Child >> 2)))
+			{
+			case EVoxelOccupancyState::Empty: NumEmpty++; break;
+			case EVoxelOccupancyState::Full: NumFull++; break;
+			case EVoxelOccupancyState::Mixed: bMixed = true; break;
+			default: break;
+			}
+		}
+
+		EVoxelOccupancyState NodeState = EVoxelOccupancyState::Unknown;
+		if (bMixed || (NumEmpty > 0 && NumFull > 0))
+		{
+			NodeState = EVoxelOccupancyState::Mixed;
+		}
+		else if (NumEmpty == 8)
+		{
+			NodeState = EVoxelOccupancyState::Empty;
+		}
+		else if (NumFull == 8)
+		{
+			NodeState = EVoxelOccupancyState::Full;
+		}
+
+		if (NodeState == EVoxelOccupancyState::Unknown)
+		{
+			Levels[Level].Remove(NodeCoord);
+		}
+		else
+		{
+			Levels[Level].Add(NodeCoord, NodeState);
+		}
+	}
+}
+
+void FVoxelOccupancyPyramid::Invalidate(const FIntVector& Min, const FIntVector& Max)
+{
+	for (int32 Level = 0; Level < NumLevels; Level++)
+	{
+		if (Levels[Level].Num() == 0)
+		{
+			continue;
+		}
+
+		const FIntVector NodeMin = GetNodeCoord(Min, Level);
+		const FIntVector NodeMax = GetNodeCoord(Max, Level);
+		for (int32 Z = NodeMin.Z; Z <= NodeMax.Z; Z++)
+		{
+			for (int32 Y = NodeMin.Y; Y <= NodeMax.Y; Y++)
+			{
+				for (int32 X = NodeMin.X; X <= NodeMax.X; X++)
+				{
+					Levels[Level].Remove(FIntVector(X, Y, Z));
+				}
+			}
+		}
+	}
+}
+
+void FVoxelOccupancyPyramid::Reset()
+{
+	for (TMap<FIntVector, EVoxelOccupancyState>& Level : Levels)
+	{
+		Level.Reset();
+	}
+}
+
+EVoxelOccupancyState FVoxelOccupancyPyramid::Classify(const FVoxelIslandBitGrid& Solid)
+{
+	const int64 NumSolid = Solid.CountSet();
+	if (NumSolid == 0)
+	{
+		return EVoxelOccupancyState::Empty;
+	}
+
+	const FIntVector Size = Solid.Max - Solid.Min + FIntVector(1);
+	return NumSolid == int64(Size.X) * Size.Y * Size.Z ? EVoxelOccupancyState::Full : EVoxelOccupancyState::Mixed;
+}
@@ -0,0 +1,73 @@
+// VoxelOccupancyPyramid.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelIslandBitGrid.h"
+
+// Occupancy summary of one pyramid node
+enum class EVoxelOccupancyState : uint8
+{
+	// Not read since the last edit
+	Unknown,
+	Empty,
+	Full,
+	Mixed
+};
+
+/**
+ * Min/max occupancy pyramid for one voxel world. Level 0 nodes are 16^3 cells (the chunk and cluster
+ * size used by detection), each level above halves the resolution up to 256^3 nodes.
+ * Nothing is read to build it: cells are recorded as detection reads them in bulk and dropped again by
+ * edits, so readers can skip empty space and fill solid space without touching the voxel octree.
+ * Game thread only.
+ */
+class FVoxelOccupancyPyramid
+{
+public:
+	static constexpr int32 CellShift = 4;
+	static constexpr int32 CellSize = 1 << CellShift;
+	static constexpr int32 NumLevels = 5;
+
+	static FORCEINLINE FIntVector GetCellCoord(const FIntVector& Voxel)
+	{
+		return FIntVector(Voxel.X >> CellShift, Voxel.Y >> CellShift, Voxel.Z >> CellShift);
+	}
+
+	static FORCEINLINE FIntVector GetNodeCoord(const FIntVector& Voxel, int32 Level)
+	{
+		const int32 Shift = CellShift + Level;
+		return FIntVector(Voxel.X >> Shift, Voxel.Y >> Shift, Voxel.Z >> Shift);
+	}
+
+	FORCEINLINE EVoxelOccupancyState GetState(int32 Level, const FIntVector& NodeCoord) const
+	{
+		const EVoxelOccupancyState* State = Levels[Level].Find(NodeCoord);
+		return State ? *State : EVoxelOccupancyState::Unknown;
+	}
+
+	FORCEINLINE EVoxelOccupancyState GetCellState(const FIntVector& CellCoord) const
+	{
+		return GetState(0, CellCoord);
+	}
+
+	// Records a cell that was just read and refreshes the nodes above it
+	void SetCellState(const FIntVector& CellCoord, EVoxelOccupancyState State);
+
+	// Records the cell from a bit grid covering exactly that cell
+	void SetCellFromGrid(const FIntVector& CellCoord, const FVoxelIslandBitGrid& Solid)
+	{
+		SetCellState(CellCoord, Classify(Solid));
+	}
+
+	// Forgets every cell overlapping the inclusive voxel box, and their ancestors
+	void Invalidate(const FIntVector& Min, const FIntVector& Max);
+
+	void Reset();
+
+	int32 GetNumKnownCells() const { return Levels[0].Num(); }
+
+	static EVoxelOccupancyState Classify(const FVoxelIslandBitGrid& Solid);
+
+private:
+	TMap<FIntVector, EVoxelOccupancyState> Levels[NumLevels];
+};
@@ -1,5 +1,10 @@
 // VoxelIslandPhysicsSimple.cpp - Simplified version to prevent freezing
 #include "VoxelIslandPhysics.h"
+#include "VoxelIslandBitGrid.h"
+#include "VoxelIslandDetection.h"
+#include "VoxelIslandTransfer.h"
+#include "VoxelIslandSnapshotGenerator.h"
+#include "VoxelOccupancyBuffer.h"
 #include "VoxelWorld.h"
 #include "VoxelWorldRootComponent.h"
 #include "VoxelTools/Gen/VoxelBoxTools.h"
@@ -18,6 +23,8 @@
 #include "TimerManager.h"
 #include "RenderingThread.h"
 #include "HAL/PlatformProcess.h"
+#include "Async/Async.h"
+#include "Kismet/GameplayStatics.h"
 
 UVoxelIslandPhysics::UVoxelIslandPhysics()
 {
@@ -36,6 +43,12 @@ void UVoxelIslandPhysics::BeginPlay()
 			UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: VoxelWorld ready for physics simulation"));
 		}
 	}
+
+	// Falling worlds carry this component too; only the worlds pieces break off from keep a pool
+	if (bPoolFallingWorlds && GetOwner() && !GetOwner()->ActorHasTag(FName("FallingVoxelWorld")))
+	{
+		WarmFallingWorldPool();
+	}
 }
 
 void UVoxelIslandPhysics::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -46,7 +59,7 @@ void UVoxelIslandPhysics::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		GetWorld()->GetTimerManager().ClearTimer(MeshCheckTimerHandle);
 	}
 	
-	// Cleanup falling voxel worlds
+	// Cleanup falling voxel worlds, live and pooled
 	for (AVoxelWorld* FallingWorld : FallingVoxelWorlds)
 	{
 		if (FallingWorld && IsValid(FallingWorld))
@@ -55,6 +68,15 @@ void UVoxelIslandPhysics::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		}
 	}
 	FallingVoxelWorlds.Empty();
+
+	for (AVoxelWorld* PooledWorld : PooledFallingWorlds)
+	{
+		if (IsValid(PooledWorld))
+		{
+			PooledWorld->Destroy();
+		}
+	}
+	PooledFallingWorlds.Empty();
 	
 	Super::EndPlay(EndPlayReason);
 }
@@ -62,6 +84,14 @@ void UVoxelIslandPhysics::EndPlay(const EEndPlayReason::Type EndPlayReason)
 void UVoxelIslandPhysics::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	
+	if (QueuedIslandChecks.Num() > 0 && GetWorld() && GetWorld()->GetTimeSeconds() - FirstQueuedCheckTime >= EditCoalesceWindow)
+	{
+		FlushQueuedIslandChecks();
+	}
+	
+	TickDetectionJobs();
+	TickBridgeAnalysis();
 	UpdateFallingPhysics(DeltaTime);
 	
 	// T6: Performance monitoring and cleanup
@@ -79,6 +109,46 @@ void UVoxelIslandPhysics::CheckForDisconnectedIslands(AVoxelWorld* World, FVecto
 		return;
 	}
 	
+	FVoxelIslandEditShape EditShape;
+	EditShape.AddSphere(World->GlobalToLocal(EditLocation), FMath::CeilToInt(EditRadius / World->VoxelSize));
+	CheckForDisconnectedIslandsInShape(World, EditShape, EditLocation, false);
+}
+
+void UVoxelIslandPhysics::CheckForDisconnectedIslandsInShape(AVoxelWorld* World, const FVoxelIslandEditShape& EditShape, const FVector& EditLocation, bool bFast)
+{
+	if (!World || !World->IsCreated() || EditShape.Spheres.Num() == 0)
+	{
+		return;
+	}
+	
+	if (bFast)
+	{
+		// Store original values
+		int32 OriginalMaxFloodFill = MaxFloodFillIterations;
+		int32 OriginalMaxTotalVoxels = MaxTotalVoxels;
+		int32 OriginalMaxQuickScan = MaxQuickScanVoxels;
+		float OriginalTowerHeight = TowerHeightLimit;
+		float OriginalHorizontalLimit = HorizontalStructureLimit;
+		
+		// Use much smaller limits for fast detection
+		MaxFloodFillIterations = 5000;    // Reduced from default 50000
+		MaxTotalVoxels = 2500000;         // Reduced from default 25000000
+		MaxQuickScanVoxels = 10000;       // Reduced from default 100000
+		TowerHeightLimit = 2500.0f;       // Reduced from default 5000
+		HorizontalStructureLimit = 4000.0f; // Reduced from default 8000
+		
+		// Call regular detection with reduced parameters
+		CheckForDisconnectedIslandsInShape(World, EditShape, EditLocation, false);
+		
+		// Restore original values
+		MaxFloodFillIterations = OriginalMaxFloodFill;
+		MaxTotalVoxels = OriginalMaxTotalVoxels;
+		MaxQuickScanVoxels = OriginalMaxQuickScan;
+		TowerHeightLimit = OriginalTowerHeight;
+		HorizontalStructureLimit = OriginalHorizontalLimit;
+		return;
+	}
+	
 	UE_LOG(LogTemp, Warning, TEXT("Edit location in world space: (%.1f,%.1f,%.1f)"), 
 		EditLocation.X, EditLocation.Y, EditLocation.Z);
 	
@@ -91,55 +161,220 @@ void UVoxelIslandPhysics::CheckForDisconnectedIslands(AVoxelWorld* World, FVecto
 	
 	UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Checking for disconnected islands at %s"), *EditLocation.ToString());
 	
-	// Convert to voxel coordinates
-	FIntVector EditCenter = World->GlobalToLocal(EditLocation);
-	int32 VoxelRadius = FMath::CeilToInt(EditRadius / World->VoxelSize);
+	InvalidateEditedRegion(World, EditShape);
+
+	// Same dig shape over chunks that have not changed since it was last checked - the answer still holds
+	FVoxelIslandResultCache* ResultCache = GetResultCache(World);
+	const uint32 SettingsHash = ResultCache ? GetDetectionSettingsHash(World) : 0;
+	const uint64 StartGeneration = ResultCache ? ResultCache->GetGeneration() : 0;
+	if (ResultCache)
+	{
+		if (const TArray<FVoxelIsland>* CachedIslands = ResultCache->Find(EditShape, SettingsHash))
+		{
+			UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Region unchanged since the last identical check, reusing its %d islands"), CachedIslands->Num());
+
+			// Processing removes islands, which edits the cache
+			TArray<FVoxelIsland> Islands = *CachedIslands;
+			ProcessDetectedIslands(World, Islands, EditLocation);
+			return;
+		}
+	}
+
+	// Graph mode: refresh the clusters the edit touched, then search outward from them for ground.
+	// The graph is kept current in every connectivity mode but can only answer face-connected checks.
+	// Its query runs on the game thread, so the async, time-sliced and brick labeling modes take precedence.
+	if (bUseConnectivityGraph && !bAsyncIslandDetection && !bTimeSlicedIslandDetection && !bUseBrickLabeling)
+	{
+		FIntVector TouchedMin, TouchedMax;
+		EditShape.GetBounds(1, TouchedMin, TouchedMax);
+
+		FVoxelConnectivityGraph& Graph = GetConnectivityGraph(World);
+		if (IslandConnectivity == EVoxelIslandConnectivity::Faces6)
+		{
+			TArray<FVoxelIsland> SeveredIslands = Graph.FindSeveredIslands(World->GetData(), TouchedMin, TouchedMax, MakeDetectionSettings(World));
+			if (ResultCache)
+			{
+				// Links reach one cluster past the clusters the search touched
+				FIntVector ClusterMin, ClusterMax;
+				Graph.GetLastQueryClusters(ClusterMin, ClusterMax);
+				ResultCache->Add(EditShape, SettingsHash,
+					(ClusterMin - FIntVector(1)) * FVoxelConnectivityGraph::ClusterSize,
+					(ClusterMax + FIntVector(2)) * FVoxelConnectivityGraph::ClusterSize - FIntVector(1),
+					StartGeneration, SeveredIslands);
+			}
+			ProcessDetectedIslands(World, SeveredIslands, EditLocation);
+			return;
+		}
+	}
+	
+	FIntVector EditMin, EditMax;
+	GetExtendedEditBounds(World, EditShape, EditMin, EditMax);
+	
+	// Floods start from the solid voxels facing the carved spheres
+	// Async mode: snapshot + detection run on a worker, islands come back through OnAsyncDetectionComplete
+	if (bAsyncIslandDetection)
+	{
+		DetectIslandsAsync(World, EditMin, EditMax, EditShape, EditLocation);
+		return;
+	}
+	
+	// Time-sliced mode: the flood race is advanced from TickComponent within the per-frame budget
+	if (bTimeSlicedIslandDetection)
+	{
+		QueueDetectionJob(World, EditMin, EditMax, EditShape, EditLocation);
+		return;
+	}
 	
+	// Synchronous detection - cost follows the size of the pieces around the edit, not the search volume
+	TArray<FVoxelIsland> DetectedIslands = DetectIslands(World, EditMin, EditMax, EditShape);
+	if (ResultCache)
+	{
+		// Search box plus the chunk of margin the live flood may read past it
+		const FIntVector Margin(SearchPadding + FVoxelIslandResultCache::ChunkSize);
+		ResultCache->Add(EditShape, SettingsHash, EditMin - Margin, EditMax + Margin, StartGeneration, DetectedIslands);
+	}
+	ProcessDetectedIslands(World, DetectedIslands, EditLocation);
+}
+
+void UVoxelIslandPhysics::InvalidateEditedRegion(AVoxelWorld* World, const FVoxelIslandEditShape& EditShape)
+{
+	for (const FVoxelIslandEditSphere& Sphere : EditShape.Spheres)
+	{
+		const FIntVector SphereMin = Sphere.Center - FIntVector(Sphere.Radius + 1);
+		const FIntVector SphereMax = Sphere.Center + FIntVector(Sphere.Radius + 1);
+
+		MarkBridgeRegionsDirty(World, SphereMin, SphereMax);
+		InvalidateOccupancyPyramid(World, SphereMin, SphereMax);
+		if (FVoxelIslandResultCache* ResultCache = GetResultCache(World))
+		{
+			ResultCache->VerifyEdited(World->GetData(), SphereMin, SphereMax);
+		}
+		if (TUniquePtr<FVoxelConnectivityGraph>* Graph = ConnectivityGraphs.Find(World))
+		{
+			(*Graph)->Invalidate(SphereMin, SphereMax);
+		}
+	}
+}
+
+void UVoxelIslandPhysics::GetExtendedEditBounds(AVoxelWorld* World, const FVoxelIslandEditShape& EditShape, FIntVector& OutMin, FIntVector& OutMax) const
+{
 	// STRUCTURE FIX: Extend bounds to capture both tall and wide structures
 	// Standard spherical bounds
-	FIntVector EditMin = EditCenter - FIntVector(VoxelRadius);
-	FIntVector EditMax = EditCenter + FIntVector(VoxelRadius);
+	EditShape.GetBounds(0, OutMin, OutMax);
+	const FIntVector EditCenter = (OutMin + OutMax) / 2;
 	
 	// Extend Z bounds significantly for towers (convert TowerHeightLimit world units to voxel units)
 	int32 TowerHeightInVoxels = FMath::CeilToInt(TowerHeightLimit / World->VoxelSize);
-	EditMin.Z = FMath::Min(EditMin.Z, EditCenter.Z - TowerHeightInVoxels);
-	EditMax.Z = FMath::Max(EditMax.Z, EditCenter.Z + TowerHeightInVoxels);
+	OutMin.Z = FMath::Min(OutMin.Z, EditCenter.Z - TowerHeightInVoxels);
+	OutMax.Z = FMath::Max(OutMax.Z, EditCenter.Z + TowerHeightInVoxels);
 	
 	// Extend X,Y bounds for horizontal structures (convert HorizontalStructureLimit world units to voxel units)
 	int32 HorizontalStructureInVoxels = FMath::CeilToInt(HorizontalStructureLimit / World->VoxelSize);
-	EditMin.X = FMath::Min(EditMin.X, EditCenter.X - HorizontalStructureInVoxels);
-	EditMax.X = FMath::Max(EditMax.X, EditCenter.X + HorizontalStructureInVoxels);
-	EditMin.Y = FMath::Min(EditMin.Y, EditCenter.Y - HorizontalStructureInVoxels);
-	EditMax.Y = FMath::Max(EditMax.Y, EditCenter.Y + HorizontalStructureInVoxels);
+	OutMin.X = FMath::Min(OutMin.X, EditCenter.X - HorizontalStructureInVoxels);
+	OutMax.X = FMath::Max(OutMax.X, EditCenter.X + HorizontalStructureInVoxels);
+	OutMin.Y = FMath::Min(OutMin.Y, EditCenter.Y - HorizontalStructureInVoxels);
+	OutMax.Y = FMath::Max(OutMax.Y, EditCenter.Y + HorizontalStructureInVoxels);
 	
 	UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Extended edit bounds - Min: %s, Max: %s (tower height: %d voxels, horizontal: %d voxels)"), 
-		*EditMin.ToString(), *EditMax.ToString(), TowerHeightInVoxels, HorizontalStructureInVoxels);
-	
-	// Use optimized synchronous detection with reduced search volume
-	TArray<FVoxelIsland> DetectedIslands = DetectIslands(World, EditMin, EditMax);
-	
-	// Process each island
-	for (const FVoxelIsland& Island : DetectedIslands)
+		*OutMin.ToString(), *OutMax.ToString(), TowerHeightInVoxels, HorizontalStructureInVoxels);
+}
+
+void UVoxelIslandPhysics::CheckForDisconnectedIslandsInWorlds(const TArray<AVoxelWorld*>& Worlds, FVector EditLocation, float EditRadius)
+{
+	struct FBatchEntry
+	{
+		TWeakObjectPtr<AVoxelWorld> World;
+		TWeakObjectPtr<UVoxelIslandPhysics> Physics;
+		TVoxelSharedPtr<FVoxelData> Data;
+		uint32 DetectionId = 0;
+	};
+	TArray<FBatchEntry> Entries;
+	TArray<FVoxelIslandBatchRequest> Requests;
+
+	for (AVoxelWorld* World : Worlds)
 	{
-		// Only create falling worlds for ungrounded islands
-		if (!Island.bIsGrounded && Island.VoxelPositions.Num() > 0)
+		if (!World || !World->IsCreated())
 		{
-			UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Creating falling world for island with %d voxels"), 
-				Island.VoxelPositions.Num());
-			
-			CreateFallingVoxelWorld(World, Island, EditLocation);
+			continue;
 		}
-		else if (Island.bIsGrounded)
+
+		// Falling worlds carry their own component with copied settings; everything else is ours
+		UVoxelIslandPhysics* Physics = World->FindComponentByClass<UVoxelIslandPhysics>();
+		if (!Physics)
 		{
-			UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Island with %d voxels is grounded, leaving in place"), 
-				Island.VoxelPositions.Num());
+			Physics = this;
+		}
+
+		FVoxelIslandEditShape EditShape;
+		EditShape.AddSphere(World->GlobalToLocal(EditLocation), FMath::CeilToInt(EditRadius / World->VoxelSize));
+		Physics->InvalidateEditedRegion(World, EditShape);
+
+		FIntVector EditMin, EditMax;
+		Physics->GetExtendedEditBounds(World, EditShape, EditMin, EditMax);
+
+		FVoxelIslandBatchRequest Request;
+		Request.Settings = Physics->MakeDetectionSettings(World);
+		if (!FVoxelIslandDetector::ComputeSearchBounds(EditMin, EditMax, Request.Settings, Request.SearchMin, Request.SearchMax))
+		{
+			continue;
 		}
+		Request.Shape = MoveTemp(EditShape);
+
+		FIntVector CarvedMin, CarvedMax;
+		Request.Shape.GetBounds(1, CarvedMin, CarvedMax);
+		Physics->RestartOverlappingDetectionJobs(World, CarvedMin, CarvedMax);
+		Physics->NumPendingAsyncDetections++;
+
+		FBatchEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.World = World;
+		Entry.Physics = Physics;
+		Entry.DetectionId = Physics->AddAsyncDetection(World, Request.SearchMin, Request.SearchMax, Request.Shape, EditLocation);
+		Entry.Data = World->GetDataSharedPtr();
+		Request.Data = Entry.Data.Get();
+		Requests.Add(MoveTemp(Request));
 	}
-	
-	if (DetectedIslands.Num() == 0)
+
+	if (Entries.Num() == 0)
 	{
-		UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: No islands detected in edit area"));
+		return;
 	}
+
+	UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Batched island detection queued for %d worlds at %s"), Entries.Num(), *EditLocation.ToString());
+
+	// One worker task for every world; the entries keep each FVoxelData alive until it has run
+	TWeakObjectPtr<UVoxelIslandPhysics> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Entries = MoveTemp(Entries), Requests = MoveTemp(Requests), EditLocation]() mutable
+	{
+		static thread_local FVoxelIslandScratch WorkerScratch;
+		TArray<TArray<FVoxelIsland>> Results = FVoxelIslandDetector::DetectIslandsBatch(Requests, &WorkerScratch);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Entries = MoveTemp(Entries), Results = MoveTemp(Results), EditLocation]()
+		{
+			TArray<FVoxelIslandBatchResult> BatchResults;
+			for (int32 Index = 0; Index < Entries.Num(); Index++)
+			{
+				if (UVoxelIslandPhysics* Physics = Entries[Index].Physics.Get())
+				{
+					Physics->NumPendingAsyncDetections--;
+					if (!Physics->FinishAsyncDetection(Entries[Index].DetectionId))
+					{
+						// Stale - the restarted detection reports through the single-world path
+						continue;
+					}
+					Physics->OnAsyncDetectionComplete(Entries[Index].World.Get(), Results[Index], EditLocation);
+				}
+
+				FVoxelIslandBatchResult& BatchResult = BatchResults.AddDefaulted_GetRef();
+				BatchResult.World = Entries[Index].World;
+				BatchResult.Islands = Results[Index];
+			}
+
+			if (UVoxelIslandPhysics* This = WeakThis.Get())
+			{
+				This->OnBatchIslandsDetected.Broadcast(BatchResults);
+			}
+		});
+	});
 }
 
 void UVoxelIslandPhysics::CheckForDisconnectedIslandsFast(AVoxelWorld* World, FVector EditLocation, float EditRadius)
@@ -151,488 +386,1174 @@ void UVoxelIslandPhysics::CheckForDisconnectedIslandsFast(AVoxelWorld* World, FV
 	
 	UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Fast island check at %s"), *EditLocation.ToString());
 	
-	// Store original values
-	int32 OriginalMaxFloodFill = MaxFloodFillIterations;
-	int32 OriginalMaxTotalVoxels = MaxTotalVoxels;
-	int32 OriginalMaxQuickScan = MaxQuickScanVoxels;
-	float OriginalTowerHeight = TowerHeightLimit;
-	float OriginalHorizontalLimit = HorizontalStructureLimit;
-	
-	// Use much smaller limits for fast detection
-	MaxFloodFillIterations = 5000;    // Reduced from default 50000
-	MaxTotalVoxels = 2500000;         // Reduced from default 25000000
-	MaxQuickScanVoxels = 10000;       // Reduced from default 100000
-	TowerHeightLimit = 2500.0f;       // Reduced from default 5000
-	HorizontalStructureLimit = 4000.0f; // Reduced from default 8000
-	
-	// Call regular detection with reduced parameters
-	CheckForDisconnectedIslands(World, EditLocation, EditRadius);
-	
-	// Restore original values
-	MaxFloodFillIterations = OriginalMaxFloodFill;
-	MaxTotalVoxels = OriginalMaxTotalVoxels;
-	MaxQuickScanVoxels = OriginalMaxQuickScan;
-	TowerHeightLimit = OriginalTowerHeight;
-	HorizontalStructureLimit = OriginalHorizontalLimit;
+	FVoxelIslandEditShape EditShape;
+	EditShape.AddSphere(World->GlobalToLocal(EditLocation), FMath::CeilToInt(EditRadius / World->VoxelSize));
+	CheckForDisconnectedIslandsInShape(World, EditShape, EditLocation, true);
 }
 
-TArray<FVoxelIsland> UVoxelIslandPhysics::DetectIslands(AVoxelWorld* World, const FIntVector& EditMin, const FIntVector& EditMax)
+void UVoxelIslandPhysics::QueueIslandCheck(AVoxelWorld* World, FVector EditLocation, float EditRadius, bool bFast)
 {
-	TArray<FVoxelIsland> Islands;
 	if (!World || !World->IsCreated())
 	{
-		return Islands;
+		return;
 	}
 
-	// Simple consistent approach: always use SearchPadding
-	FIntVector SearchMin = EditMin - FIntVector(SearchPadding);
-	FIntVector SearchMax = EditMax + FIntVector(SearchPadding);
-	int64 TotalVoxels = (int64)(SearchMax.X - SearchMin.X + 1) * (SearchMax.Y - SearchMin.Y + 1) * (SearchMax.Z - SearchMin.Z + 1);
-	
-	// Safety check against MaxTotalVoxels
-	if (TotalVoxels > MaxTotalVoxels)
+	if (EditCoalesceWindow <= 0.0f)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Search volume too large (%lld > %d), skipping island detection"), TotalVoxels, MaxTotalVoxels);
-		return Islands;
+		if (bFast)
+		{
+			CheckForDisconnectedIslandsFast(World, EditLocation, EditRadius);
+		}
+		else
+		{
+			CheckForDisconnectedIslands(World, EditLocation, EditRadius);
+		}
+		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Checking %lld voxels for islands"), TotalVoxels);
+	FQueuedIslandCheck NewCheck;
+	NewCheck.World = World;
+	NewCheck.Shape.AddSphere(World->GlobalToLocal(EditLocation), FMath::CeilToInt(EditRadius / World->VoxelSize));
+	NewCheck.Shape.GetBounds(SearchPadding, NewCheck.Min, NewCheck.Max);
+	NewCheck.EditLocation = EditLocation;
+	NewCheck.bFast = bFast;
+	NewCheck.NumEdits = 1;
 
-	// Get data lock for entire search area
-	FVoxelReadScopeLock Lock(World->GetData(), FVoxelIntBox(SearchMin, SearchMax), "IslandDetection");
+	// Detections that run before this check is flushed must not trust cells the dig changed
+	FIntVector CarvedMin, CarvedMax;
+	NewCheck.Shape.GetBounds(1, CarvedMin, CarvedMax);
+	InvalidateOccupancyPyramid(World, CarvedMin, CarvedMax);
+	if (FVoxelIslandResultCache* ResultCache = GetResultCache(World))
+	{
+		ResultCache->VerifyEdited(World->GetData(), CarvedMin, CarvedMax);
+	}
 
-	// Track all visited voxels
-	TSet<FIntVector> GlobalVisited;
-	
-	// SPATIAL CLUSTERING APPROACH - dramatically reduce island candidates
-	// Group nearby voxels into clusters first, then only flood-fill promising clusters
-	
-	const int32 ClusterSize = 16; // Voxel units per cluster (16*20cm = 3.2m resolution)
-	TMap<FIntVector, TArray<FIntVector>> VoxelClusters; // ClusterCoord -> VoxelsInCluster
-	
-	int32 CheckedVoxels = 0;
-	int32 HighZVoxels = 0;
-	
-	// Scan from TOP to BOTTOM to prioritize towers/bridges over ground
-	for (int32 Z = SearchMax.Z; Z >= SearchMin.Z; Z -= 2) // Skip every other Z level for speed
+	if (QueuedIslandChecks.Num() == 0)
 	{
-		for (int32 X = SearchMin.X; X <= SearchMax.X; X += 2) // Skip every other X
-		{
-			for (int32 Y = SearchMin.Y; Y <= SearchMax.Y; Y += 2) // Skip every other Y
-			{
-				CheckedVoxels++;
-				if (CheckedVoxels % 10000 == 0)
-				{
-					UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Scanned %d voxels, %d clusters, %d high-Z"), 
-						CheckedVoxels, VoxelClusters.Num(), HighZVoxels);
-				}
-				
-				FIntVector Pos(X, Y, Z);
-				FVoxelValue Value = World->GetData().GetValue(Pos, 0);
-				if (!Value.IsEmpty())
-				{
-					// Track high-Z voxels
-					if (Z > -200)
-					{
-						HighZVoxels++;
-					}
-					
-					// Map voxel to cluster coordinates
-					FIntVector ClusterCoord(
-						Pos.X / ClusterSize,
-						Pos.Y / ClusterSize,
-						Pos.Z / ClusterSize
-					);
-					
-					// Add voxel to its cluster
-					VoxelClusters.FindOrAdd(ClusterCoord).Add(Pos);
-				}
-				
-				// Early termination - stop if too many clusters and insufficient elevated structure
-				if (VoxelClusters.Num() > 500)
-				{
-					if (HighZVoxels >= 100)
-					{
-						UE_LOG(LogTemp, Warning, TEXT("[SMART TERMINATION] Found %d clusters with %d high-Z voxels"), 
-							VoxelClusters.Num(), HighZVoxels);
-						break;
-					}
-				}
-			}
-			if (VoxelClusters.Num() > 500 && HighZVoxels >= 100) break;
-		}
-		if (VoxelClusters.Num() > 500 && HighZVoxels >= 100) break;
+		FirstQueuedCheckTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
 	}
-	
-	UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Found %d clusters (reduced from potential millions of voxels)"), VoxelClusters.Num());
-	
-	// Convert promising clusters to seed points for flood fill
-	TArray<FIntVector> IslandSeeds;
-	for (const auto& ClusterPair : VoxelClusters)
+
+	// Absorb every queued region whose padded box touches the new one. Absorbing can grow the box into
+	// further regions, so keep going until nothing overlaps - the queue stays a set of disjoint boxes.
+	bool bMerged = true;
+	while (bMerged)
 	{
-		const TArray<FIntVector>& ClusterVoxels = ClusterPair.Value;
-		
-		// Only process clusters with elevated voxels or reasonable size
-		bool HasElevatedVoxels = false;
-		for (const FIntVector& Voxel : ClusterVoxels)
-		{
-			if (Voxel.Z > -200)
-			{
-				HasElevatedVoxels = true;
-				break;
-			}
-		}
-		
-		// Use cluster center as seed point
-		if (HasElevatedVoxels || ClusterVoxels.Num() < 50) // Small clusters or elevated ones
+		bMerged = false;
+		for (int32 Index = 0; Index < QueuedIslandChecks.Num(); Index++)
 		{
-			if (ClusterVoxels.Num() > 0)
+			const FQueuedIslandCheck& Queued = QueuedIslandChecks[Index];
+			if (Queued.World != NewCheck.World || Queued.bFast != NewCheck.bFast ||
+				Queued.Min.X > NewCheck.Max.X || Queued.Max.X < NewCheck.Min.X ||
+				Queued.Min.Y > NewCheck.Max.Y || Queued.Max.Y < NewCheck.Min.Y ||
+				Queued.Min.Z > NewCheck.Max.Z || Queued.Max.Z < NewCheck.Min.Z)
 			{
-				IslandSeeds.Add(ClusterVoxels[0]); // Use first voxel as seed
+				continue;
 			}
+
+			NewCheck.Shape.Spheres.Append(Queued.Shape.Spheres);
+			NewCheck.Min = FIntVector(FMath::Min(NewCheck.Min.X, Queued.Min.X), FMath::Min(NewCheck.Min.Y, Queued.Min.Y), FMath::Min(NewCheck.Min.Z, Queued.Min.Z));
+			NewCheck.Max = FIntVector(FMath::Max(NewCheck.Max.X, Queued.Max.X), FMath::Max(NewCheck.Max.Y, Queued.Max.Y), FMath::Max(NewCheck.Max.Z, Queued.Max.Z));
+			NewCheck.NumEdits += Queued.NumEdits;
+			QueuedIslandChecks.RemoveAtSwap(Index);
+			bMerged = true;
+			break;
 		}
 	}
-	
-	UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Processing %d island seeds (down from %d clusters)"), 
-		IslandSeeds.Num(), VoxelClusters.Num());
 
-	// Flood fill to find connected components - now using smart seed points
-	for (const FIntVector& StartPos : IslandSeeds)
+	QueuedIslandChecks.Add(MoveTemp(NewCheck));
+}
+
+void UVoxelIslandPhysics::FlushQueuedIslandChecks()
+{
+	if (QueuedIslandChecks.Num() == 0)
 	{
-		if (GlobalVisited.Contains(StartPos))
-		{
-			continue; // Already part of another island
-		}
+		return;
+	}
 
-		// Start new island with flood fill
-		TSet<FIntVector> IslandVoxels;
-		TArray<FIntVector> Queue;
-		Queue.Add(StartPos);
-		IslandVoxels.Add(StartPos);
-		GlobalVisited.Add(StartPos);
+	// Detection can queue follow-up checks, so run from a local copy
+	TArray<FQueuedIslandCheck> Checks = MoveTemp(QueuedIslandChecks);
+	QueuedIslandChecks.Reset();
 
-		// Flood fill using 6-connectivity (adjacent faces)
-		const FIntVector Directions[6] = {
-			FIntVector(1, 0, 0), FIntVector(-1, 0, 0),
-			FIntVector(0, 1, 0), FIntVector(0, -1, 0),
-			FIntVector(0, 0, 1), FIntVector(0, 0, -1)
-		};
+	int32 NumEdits = 0;
+	for (const FQueuedIslandCheck& Check : Checks)
+	{
+		NumEdits += Check.NumEdits;
+	}
+	UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Coalesced %d digs into %d island checks"), NumEdits, Checks.Num());
 
-		int32 FloodFillIterations = 0;
-		// Use simple MaxFloodFillIterations limit
-		const int32 UsedMaxFloodFillIterations = MaxFloodFillIterations;
-		
-		while (Queue.Num() > 0 && FloodFillIterations < UsedMaxFloodFillIterations && IslandVoxels.Num() <= MaxIslandVoxels)
-		{
-			FloodFillIterations++;
-			if (FloodFillIterations % 5000 == 0)
-			{
-				UE_LOG(LogTemp, Warning, TEXT("Flood fill iteration %d, island size: %d, queue: %d"), FloodFillIterations, IslandVoxels.Num(), Queue.Num());
-			}
-			
-			FIntVector Current = Queue.Pop();
-			
-			// Check all 6 adjacent positions
-			for (int32 DirIdx = 0; DirIdx < 6; DirIdx++)
-			{
-				FIntVector Neighbor = Current + Directions[DirIdx];
-				
-				if (GlobalVisited.Contains(Neighbor))
-				{
-					continue;
-				}
+	for (const FQueuedIslandCheck& Check : Checks)
+	{
+		CheckForDisconnectedIslandsInShape(Check.World.Get(), Check.Shape, Check.EditLocation, Check.bFast);
+	}
+}
 
-				// Stay within search bounds
-				if (Neighbor.X < SearchMin.X || Neighbor.X > SearchMax.X ||
-					Neighbor.Y < SearchMin.Y || Neighbor.Y > SearchMax.Y ||
-					Neighbor.Z < SearchMin.Z || Neighbor.Z > SearchMax.Z)
-				{
-					continue;
-				}
+FVoxelIslandDetectionSettings UVoxelIslandPhysics::MakeDetectionSettings(AVoxelWorld* World)
+{
+	FVoxelIslandDetectionSettings Settings;
+	Settings.SearchPadding = SearchPadding;
+	Settings.MaxFloodFillIterations = MaxFloodFillIterations;
+	Settings.MaxTotalVoxels = MaxTotalVoxels;
+	Settings.MaxIslandVoxels = MaxIslandVoxels;
+	Settings.bUseBrickLabeling = bUseBrickLabeling;
+	Settings.Connectivity = EVoxelConnectivity(IslandConnectivity);
+	Settings.ParallelFloodMinVoxels = ParallelFloodMinVoxels;
+	Settings.Anchors = GetGroundAnchors(World);
+	return Settings;
+}
 
-				// Check if neighbor is solid
-				FVoxelValue NeighborValue = World->GetData().GetValue(Neighbor, 0);
-				if (!NeighborValue.IsEmpty())
-				{
-					Queue.Add(Neighbor);
-					IslandVoxels.Add(Neighbor);
-					GlobalVisited.Add(Neighbor);
-				}
-			}
-		}
-		
-		// Check termination reasons
-		if (IslandVoxels.Num() > MaxIslandVoxels)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[SKIPPING LARGE ISLAND] Island too large (%d voxels > %d limit), likely terrain/ground - ignoring"), 
-				IslandVoxels.Num(), MaxIslandVoxels);
-			continue; // Skip this island entirely - likely connected ground/terrain
-		}
-		else if (FloodFillIterations >= UsedMaxFloodFillIterations)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[ISLAND TRUNCATED] Flood fill hit iteration limit (%d), island may be incomplete! Voxels found: %d"), 
-				UsedMaxFloodFillIterations, IslandVoxels.Num());
-			// Continue processing the partial island rather than abandoning it completely
-		}
+TArray<FVoxelIsland> UVoxelIslandPhysics::DetectIslands(AVoxelWorld* World, const FIntVector& EditMin, const FIntVector& EditMax, const FVoxelIslandEditShape& Shape)
+{
+	TArray<FVoxelIsland> Islands;
+	if (!World || !World->IsCreated())
+	{
+		return Islands;
+	}
+
+	const FVoxelIslandDetectionSettings Settings = MakeDetectionSettings(World);
+
+	FIntVector SearchMin, SearchMax;
+	if (!FVoxelIslandDetector::ComputeSearchBounds(EditMin, EditMax, Settings, SearchMin, SearchMax))
+	{
+		return Islands;
+	}
+
+	return FVoxelIslandDetector::DetectIslands(World->GetData(), SearchMin, SearchMax, Shape, Settings, &DetectionScratch, GetOccupancyPyramid(World));
+}
+
+void UVoxelIslandPhysics::DetectIslandsAsync(AVoxelWorld* World, const FIntVector& EditMin, const FIntVector& EditMax, const FVoxelIslandEditShape& Shape, const FVector& EditLocation)
+{
+	if (!World || !World->IsCreated())
+	{
+		return;
+	}
+
+	const FVoxelIslandDetectionSettings Settings = MakeDetectionSettings(World);
+
+	FIntVector SearchMin, SearchMax;
+	if (!FVoxelIslandDetector::ComputeSearchBounds(EditMin, EditMax, Settings, SearchMin, SearchMax))
+	{
+		return;
+	}
+
+	// This dig changed voxels that earlier detections may already have read
+	FIntVector CarvedMin, CarvedMax;
+	Shape.GetBounds(1, CarvedMin, CarvedMax);
+	RestartOverlappingDetectionJobs(World, CarvedMin, CarvedMax);
+
+	StartAsyncDetection(World, SearchMin, SearchMax, Shape, EditLocation);
+}
+
+void UVoxelIslandPhysics::StartAsyncDetection(AVoxelWorld* World, const FIntVector& SearchMin, const FIntVector& SearchMax, const FVoxelIslandEditShape& Shape, const FVector& EditLocation)
+{
+	const FVoxelIslandDetectionSettings Settings = MakeDetectionSettings(World);
+	const uint32 DetectionId = AddAsyncDetection(World, SearchMin, SearchMax, Shape, EditLocation);
+
+	// The shared data pointer keeps FVoxelData alive even if the world is destroyed mid-detection
+	TVoxelSharedPtr<FVoxelData> Data = World->GetDataSharedPtr();
+	TWeakObjectPtr<UVoxelIslandPhysics> WeakThis(this);
+	TWeakObjectPtr<AVoxelWorld> WeakWorld(World);
+
+	NumPendingAsyncDetections++;
+	UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Async island detection queued (%d pending)"), NumPendingAsyncDetections);
 
-		// Only create island if it has sufficient voxels
-		if (IslandVoxels.Num() >= 5)
+	Async(EAsyncExecution::ThreadPool, [Data, Settings, SearchMin, SearchMax, Shape, WeakThis, WeakWorld, EditLocation, DetectionId]()
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		// Pool threads are long-lived, so each keeps its own temporaries across detections
+		static thread_local FVoxelIslandScratch WorkerScratch;
+
+		FVoxelIslandBitGrid Solid;
+		FVoxelIslandDetector::SnapshotOccupancy(*Data, SearchMin, SearchMax, Solid);
+		TArray<FVoxelIsland> Islands = FVoxelIslandDetector::DetectIslandsInSnapshot(Solid, Shape, Settings, &WorkerScratch);
+
+		UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Async island detection finished in %.2fms on worker"),
+			(FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, WeakWorld, EditLocation, DetectionId, Islands = MoveTemp(Islands)]()
 		{
-			FVoxelIsland NewIsland;
-			NewIsland.VoxelPositions = IslandVoxels.Array();
-			
-			// Calculate bounds
-			NewIsland.MinBounds = StartPos;
-			NewIsland.MaxBounds = StartPos;
-			for (const FIntVector& Pos : NewIsland.VoxelPositions)
+			UVoxelIslandPhysics* This = WeakThis.Get();
+			if (!This)
 			{
-				NewIsland.MinBounds = FIntVector(
-					FMath::Min(NewIsland.MinBounds.X, Pos.X),
-					FMath::Min(NewIsland.MinBounds.Y, Pos.Y),
-					FMath::Min(NewIsland.MinBounds.Z, Pos.Z)
-				);
-				NewIsland.MaxBounds = FIntVector(
-					FMath::Max(NewIsland.MaxBounds.X, Pos.X),
-					FMath::Max(NewIsland.MaxBounds.Y, Pos.Y),
-					FMath::Max(NewIsland.MaxBounds.Z, Pos.Z)
-				);
+				return;
 			}
 
-			// Calculate center of mass
-			FVector Sum = FVector::ZeroVector;
-			for (const FIntVector& Pos : NewIsland.VoxelPositions)
+			This->NumPendingAsyncDetections--;
+			if (This->FinishAsyncDetection(DetectionId))
 			{
-				Sum += FVector(Pos);
+				This->OnAsyncDetectionComplete(WeakWorld.Get(), Islands, EditLocation);
 			}
-			NewIsland.CenterOfMass = Sum / NewIsland.VoxelPositions.Num();
+		});
+	});
+}
+
+uint32 UVoxelIslandPhysics::AddAsyncDetection(AVoxelWorld* World, const FIntVector& SearchMin, const FIntVector& SearchMax, const FVoxelIslandEditShape& Shape, const FVector& EditLocation)
+{
+	const uint32 DetectionId = NextAsyncDetectionId++;
+	FPendingAsyncDetection& Detection = AsyncDetections.Add(DetectionId);
+	Detection.World = World;
+	Detection.SearchMin = SearchMin;
+	Detection.SearchMax = SearchMax;
+	Detection.Shape = Shape;
+	Detection.EditLocation = EditLocation;
+	return DetectionId;
+}
 
-			// Check if island is grounded (connected to world bottom)
-			TSet<FIntVector> GroundCheckVisited;
-			NewIsland.bIsGrounded = IsConnectedToGround(World, StartPos, GroundCheckVisited);
+bool UVoxelIslandPhysics::FinishAsyncDetection(uint32 DetectionId)
+{
+	FPendingAsyncDetection Detection;
+	if (!AsyncDetections.RemoveAndCopyValue(DetectionId, Detection))
+	{
+		// The world was forgotten while the worker ran
+		return false;
+	}
 
-			Islands.Add(NewIsland);
-		}
+	if (!Detection.bStale)
+	{
+		return true;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Found %d islands in area"), Islands.Num());
-	return Islands;
+	// Its snapshot may predate an edit that reconnected or removed a piece - detect again on current data
+	AVoxelWorld* World = Detection.World.Get();
+	if (IsValid(World) && World->IsCreated())
+	{
+		UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Async island detection overlapped a later edit, restarting"));
+		StartAsyncDetection(World, Detection.SearchMin, Detection.SearchMax, Detection.Shape, Detection.EditLocation);
+	}
+	return false;
 }
 
-bool UVoxelIslandPhysics::IsConnectedToGround(AVoxelWorld* World, const FIntVector& StartPos, TSet<FIntVector>& Visited)
+void UVoxelIslandPhysics::QueueDetectionJob(AVoxelWorld* World, const FIntVector& EditMin, const FIntVector& EditMax, const FVoxelIslandEditShape& Shape, const FVector& EditLocation)
 {
-	if (!World)
+	const FVoxelIslandDetectionSettings Settings = MakeDetectionSettings(World);
+
+	FIntVector SearchMin, SearchMax;
+	if (!FVoxelIslandDetector::ComputeSearchBounds(EditMin, EditMax, Settings, SearchMin, SearchMax))
 	{
-		return true; // Assume grounded if can't check
+		return;
 	}
 
-	const int32 LocalGroundLevel = 0; // Consider anything below this as "ground" (more restrictive)
-	
-	// BFS to find path to ground
-	TArray<FIntVector> Queue;
-	Queue.Add(StartPos);
-	Visited.Add(StartPos);
+	// This dig changed voxels that earlier jobs may already have read
+	FIntVector CarvedMin, CarvedMax;
+	Shape.GetBounds(1, CarvedMin, CarvedMax);
+	RestartOverlappingDetectionJobs(World, CarvedMin, CarvedMax);
 
-	const FIntVector Directions[6] = {
-		FIntVector(1, 0, 0), FIntVector(-1, 0, 0),
-		FIntVector(0, 1, 0), FIntVector(0, -1, 0),
-		FIntVector(0, 0, 1), FIntVector(0, 0, -1)
-	};
+	FPendingDetectionJob& Pending = DetectionJobs.AddDefaulted_GetRef();
+	Pending.World = World;
+	Pending.Job = MakeUnique<FVoxelIslandDetectionJob>(SearchMin, SearchMax, Shape, Settings, &JobScratch, GetOccupancyPyramid(World));
+	Pending.EditLocation = EditLocation;
+
+	UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Time-sliced island detection queued (%d pending)"), DetectionJobs.Num());
+}
 
-	const int32 MaxSearchDistance = 10000; // LARGE ISLAND FIX: 10x increase for tall towers
-	int32 SearchCount = 0;
+void UVoxelIslandPhysics::TickDetectionJobs()
+{
+	const double EndTime = FPlatformTime::Seconds() + DetectionBudgetMicroseconds * 1e-6;
 
-	while (Queue.Num() > 0 && SearchCount < MaxSearchDistance)
+	while (DetectionJobs.Num() > 0)
 	{
-		FIntVector Current = Queue.Pop();
-		SearchCount++;
+		const double Remaining = EndTime - FPlatformTime::Seconds();
+		if (Remaining <= 0.0)
+		{
+			break;
+		}
 
-		// Check if we've reached ground level
-		if (Current.Z <= LocalGroundLevel)
+		FPendingDetectionJob& Pending = DetectionJobs[0];
+		AVoxelWorld* World = Pending.World.Get();
+		if (!IsValid(World) || !World->IsCreated())
 		{
-			return true;
+			DetectionJobs.RemoveAt(0);
+			continue;
 		}
 
-		// Search adjacent voxels
-		for (int32 DirIdx = 0; DirIdx < 6; DirIdx++)
+		if (!Pending.Job->Tick(World->GetData(), Remaining))
+		{
+			break;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Time-sliced island detection finished over %d ticks (%.2fms total)"),
+			Pending.Job->GetNumTicks(), Pending.Job->GetTotalSeconds() * 1000.0);
+
+		const TArray<FVoxelIsland> Islands = Pending.Job->ConsumeIslands();
+		const FVector EditLocation = Pending.EditLocation;
+		DetectionJobs.RemoveAt(0);
+
+		// Voxels outside the restarted regions may still have changed since they were read
+		OnAsyncDetectionComplete(World, Islands, EditLocation);
+	}
+}
+
+void UVoxelIslandPhysics::RestartOverlappingDetectionJobs(AVoxelWorld* World, const FIntVector& Min, const FIntVector& Max)
+{
+	for (FPendingDetectionJob& Pending : DetectionJobs)
+	{
+		if (Pending.World.Get() == World && Pending.Job->Overlaps(Min, Max))
+		{
+			Pending.Job->Restart();
+		}
+	}
+
+	MarkAsyncDetectionsStale(World, Min, Max);
+}
+
+void UVoxelIslandPhysics::MarkAsyncDetectionsStale(AVoxelWorld* World, const FIntVector& Min, const FIntVector& Max)
+{
+	for (TPair<uint32, FPendingAsyncDetection>& Pair : AsyncDetections)
+	{
+		FPendingAsyncDetection& Detection = Pair.Value;
+		if (Detection.World.Get() == World &&
+			Min.X <= Detection.SearchMax.X && Max.X >= Detection.SearchMin.X &&
+			Min.Y <= Detection.SearchMax.Y && Max.Y >= Detection.SearchMin.Y &&
+			Min.Z <= Detection.SearchMax.Z && Max.Z >= Detection.SearchMin.Z)
+		{
+			Detection.bStale = true;
+		}
+	}
+}
+
+void UVoxelIslandPhysics::OnAsyncDetectionComplete(AVoxelWorld* World, const TArray<FVoxelIsland>& Islands, const FVector& EditLocation)
+{
+	if (!IsValid(World) || !World->IsCreated())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Async detection finished but source world is gone, dropping %d islands"), Islands.Num());
+		return;
+	}
+
+	// The world kept changing while the worker ran - drop islands that were dug away or rebuilt since the snapshot
+	TArray<FVoxelIsland> ValidIslands;
+	ValidIslands.Reserve(Islands.Num());
+	for (const FVoxelIsland& Island : Islands)
+	{
+		if (Island.bIsGrounded || IsIslandStillPresent(World, Island))
+		{
+			ValidIslands.Add(Island);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Island with %d voxels changed since snapshot, skipping"), Island.Voxels.Num());
+		}
+	}
+
+	ProcessDetectedIslands(World, ValidIslands, EditLocation);
+}
+
+FVoxelConnectivityGraph& UVoxelIslandPhysics::GetConnectivityGraph(AVoxelWorld* World)
+{
+	// Drop graphs of worlds that were destroyed (falling islands get cleaned up regularly)
+	for (auto It = ConnectivityGraphs.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TUniquePtr<FVoxelConnectivityGraph>& Graph = ConnectivityGraphs.FindOrAdd(World);
+	if (!Graph)
+	{
+		Graph = MakeUnique<FVoxelConnectivityGraph>();
+	}
+	Graph->SetOccupancyPyramid(GetOccupancyPyramid(World));
+	return *Graph;
+}
+
+FVoxelOccupancyPyramid* UVoxelIslandPhysics::GetOccupancyPyramid(AVoxelWorld* World)
+{
+	if (!bUseOccupancyPyramid)
+	{
+		// Cells recorded earlier are not invalidated while disabled, so they cannot be trusted later
+		OccupancyPyramids.Reset();
+		return nullptr;
+	}
+
+	for (auto It = OccupancyPyramids.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TUniquePtr<FVoxelOccupancyPyramid>& Pyramid = OccupancyPyramids.FindOrAdd(World);
+	if (!Pyramid)
+	{
+		Pyramid = MakeUnique<FVoxelOccupancyPyramid>();
+	}
+	return Pyramid.Get();
+}
+
+FVoxelIslandResultCache* UVoxelIslandPhysics::GetResultCache(AVoxelWorld* World)
+{
+	if (!bCacheDetectionResults)
+	{
+		// Edits are not recorded while disabled, so old generations cannot be trusted later
+		ResultCaches.Reset();
+		return nullptr;
+	}
+
+	for (auto It = ResultCaches.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TUniquePtr<FVoxelIslandResultCache>& ResultCache = ResultCaches.FindOrAdd(World);
+	if (!ResultCache)
+	{
+		ResultCache = MakeUnique<FVoxelIslandResultCache>();
+	}
+	return ResultCache.Get();
+}
+
+void UVoxelIslandPhysics::MarkResultCacheEdited(AVoxelWorld* World, const FIntVector& VoxelMin, const FIntVector& VoxelMax)
+{
+	if (TUniquePtr<FVoxelIslandResultCache>* ResultCache = ResultCaches.Find(World))
+	{
+		(*ResultCache)->MarkEdited(VoxelMin, VoxelMax);
+	}
+}
+
+uint32 UVoxelIslandPhysics::GetDetectionSettingsHash(AVoxelWorld* World)
+{
+	uint32 Hash = GetTypeHash(bUseConnectivityGraph);
+	Hash = HashCombine(Hash, GetTypeHash(bUseBrickLabeling));
+	Hash = HashCombine(Hash, GetTypeHash(uint8(IslandConnectivity)));
+	Hash = HashCombine(Hash, GetTypeHash(SearchPadding));
+	Hash = HashCombine(Hash, GetTypeHash(MaxTotalVoxels));
+	Hash = HashCombine(Hash, GetTypeHash(MaxIslandVoxels));
+	Hash = HashCombine(Hash, GetTypeHash(TowerHeightLimit));
+	Hash = HashCombine(Hash, GetTypeHash(HorizontalStructureLimit));
+
+	// A rebuilt anchor index has a new generation, even when it reuses the old one's address
+	Hash = HashCombine(Hash, GetTypeHash(GetGroundAnchors(World)->GetGeneration()));
+	return Hash;
+}
+
+void UVoxelIslandPhysics::InvalidateOccupancyPyramid(AVoxelWorld* World, const FIntVector& VoxelMin, const FIntVector& VoxelMax)
+{
+	if (TUniquePtr<FVoxelOccupancyPyramid>* Pyramid = OccupancyPyramids.Find(World))
+	{
+		(*Pyramid)->Invalidate(VoxelMin, VoxelMax);
+	}
+}
+
+TSharedPtr<const FVoxelGroundAnchorIndex> UVoxelIslandPhysics::GetGroundAnchors(AVoxelWorld* World)
+{
+	// Drop anchors of worlds that were destroyed, like the graphs, pyramids and result caches
+	for (auto It = GroundAnchors.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if (const TSharedPtr<const FVoxelGroundAnchorIndex>* Existing = GroundAnchors.Find(World))
+	{
+		if ((*Existing)->GetGroundLevel() == GroundAnchorLevel)
+		{
+			return *Existing;
+		}
+	}
+
+	TSharedPtr<FVoxelGroundAnchorIndex> Anchors = MakeShared<FVoxelGroundAnchorIndex>();
+	Anchors->SetGroundLevel(GroundAnchorLevel);
+
+	// Heightfield cells are resampled into voxel columns of this world
+	if (AnchorHeightfield.Num() > 0)
+	{
+		const int32 CellVoxels = FMath::Max(1, FMath::RoundToInt(AnchorHeightfieldCellSize / World->VoxelSize));
+		const FIntVector VoxelOrigin = World->GlobalToLocal(FVector(AnchorHeightfieldOrigin, 0.0f));
+
+		TArray<int32> VoxelHeights;
+		VoxelHeights.SetNumUninitialized(AnchorHeightfield.Num());
+		for (int32 Index = 0; Index < AnchorHeightfield.Num(); Index++)
+		{
+			// Only the height is converted per cell - voxel worlds are never rotated
+			VoxelHeights[Index] = World->GlobalToLocal(FVector(AnchorHeightfieldOrigin, AnchorHeightfield[Index])).Z;
+		}
+
+		Anchors->SetHeightfield(VoxelOrigin, CellVoxels, AnchorHeightfieldCountX, AnchorHeightfieldCountY, MoveTemp(VoxelHeights));
+	}
+
+	if (!AnchorActorTag.IsNone())
+	{
+		TArray<AActor*> TaggedActors;
+		UGameplayStatics::GetAllActorsWithTag(GetWorld(), AnchorActorTag, TaggedActors);
+
+		for (AActor* Actor : TaggedActors)
+		{
+			if (!Actor || Actor == World)
+			{
+				continue;
+			}
+
+			FVector BoundsOrigin, BoundsExtent;
+			Actor->GetActorBounds(false, BoundsOrigin, BoundsExtent);
+
+			const FIntVector A = World->GlobalToLocal(BoundsOrigin - BoundsExtent);
+			const FIntVector B = World->GlobalToLocal(BoundsOrigin + BoundsExtent);
+			Anchors->AddAnchorBox(
+				FIntVector(FMath::Min(A.X, B.X), FMath::Min(A.Y, B.Y), FMath::Min(A.Z, B.Z)),
+				FIntVector(FMath::Max(A.X, B.X), FMath::Max(A.Y, B.Y), FMath::Max(A.Z, B.Z)));
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Built ground anchors for %s (level %d, %d anchor boxes, %d heightfield cells)"),
+		*World->GetName(), GroundAnchorLevel, Anchors->GetNumAnchorBoxes(), AnchorHeightfield.Num());
+
+	GroundAnchors.Add(World, Anchors);
+	return Anchors;
+}
+
+void UVoxelIslandPhysics::SetAnchorHeightfield(FVector2D Origin, float CellSize, int32 CountX, int32 CountY, const TArray<float>& Heights)
+{
+	if (CountX <= 0 || CountY <= 0 || CellSize <= 0.0f || Heights.Num() != CountX * CountY)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Invalid anchor heightfield (%dx%d cells, %d heights), clearing it"), CountX, CountY, Heights.Num());
+		AnchorHeightfield.Reset();
+	}
+	else
+	{
+		AnchorHeightfieldOrigin = Origin;
+		AnchorHeightfieldCellSize = CellSize;
+		AnchorHeightfieldCountX = CountX;
+		AnchorHeightfieldCountY = CountY;
+		AnchorHeightfield = Heights;
+	}
+
+	InvalidateGroundAnchors();
+}
+
+void UVoxelIslandPhysics::InvalidateGroundAnchors()
+{
+	GroundAnchors.Empty();
+}
+
+void UVoxelIslandPhysics::NotifyVoxelsEdited(AVoxelWorld* World, FVector BoundsMin, FVector BoundsMax)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	const FIntVector VoxelMin = World->GlobalToLocal(BoundsMin.ComponentMin(BoundsMax)) - FIntVector(1);
+	const FIntVector VoxelMax = World->GlobalToLocal(BoundsMin.ComponentMax(BoundsMax)) + FIntVector(1);
+
+	if (TUniquePtr<FVoxelConnectivityGraph>* Graph = ConnectivityGraphs.Find(World))
+	{
+		(*Graph)->Invalidate(VoxelMin, VoxelMax);
+	}
+
+	InvalidateOccupancyPyramid(World, VoxelMin, VoxelMax);
+	MarkResultCacheEdited(World, VoxelMin, VoxelMax);
+	RestartOverlappingDetectionJobs(World, VoxelMin, VoxelMax);
+	MarkBridgeRegionsDirty(World, VoxelMin, VoxelMax);
+}
+
+bool UVoxelIslandPhysics::ShouldCheckEditForIslands(AVoxelWorld* World, FVector EditLocation, float EditRadius)
+{
+	if (!bPredictSeveringEdits || !World || !World->IsCreated())
+	{
+		return true;
+	}
+
+	// One voxel of margin, same as the graph invalidation - the shell around the dig is what gets cut
+	const FIntVector Center = World->GlobalToLocal(EditLocation);
+	const FIntVector Extent(FMath::CeilToInt(EditRadius / World->VoxelSize) + 1);
+
+	FBridgeRegions& Regions = BridgeRegions.FindOrAdd(World);
+	Regions.LastEditVoxel = Center;
+
+	// Any edit in the analysed box since the analysis started makes every dig in it a candidate
+	const bool bMaySever = Regions.MaySever(Center - Extent, Center + Extent);
+	Regions.MarkDirty(Center - Extent, Center + Extent);
+
+	if (!bMaySever)
+	{
+		// No check will refresh the graph or restart jobs for this dig, so do it here
+		if (TUniquePtr<FVoxelConnectivityGraph>* Graph = ConnectivityGraphs.Find(World))
+		{
+			(*Graph)->Invalidate(Center - Extent, Center + Extent);
+		}
+		InvalidateOccupancyPyramid(World, Center - Extent, Center + Extent);
+		MarkResultCacheEdited(World, Center - Extent, Center + Extent);
+		RestartOverlappingDetectionJobs(World, Center - Extent, Center + Extent);
+
+		UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Dig at %s touches no weak link, skipping island check"), *EditLocation.ToString());
+	}
+	return bMaySever;
+}
+
+void UVoxelIslandPhysics::MarkBridgeRegionsDirty(AVoxelWorld* World, const FIntVector& VoxelMin, const FIntVector& VoxelMax)
+{
+	if (FBridgeRegions* Regions = BridgeRegions.Find(World))
+	{
+		Regions->MarkDirty(VoxelMin, VoxelMax);
+	}
+}
+
+void UVoxelIslandPhysics::TickBridgeAnalysis()
+{
+	if (!bPredictSeveringEdits || !GetWorld())
+	{
+		return;
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	for (auto It = BridgeRegions.CreateIterator(); It; ++It)
+	{
+		AVoxelWorld* World = It.Key().Get();
+		if (!IsValid(World) || !World->IsCreated())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		FBridgeRegions& Regions = It.Value();
+		if (Regions.bAnalysisInFlight || (Regions.bValid && Regions.DirtyClusters.Num() == 0) ||
+			(Regions.bValid && Now - Regions.LastAnalysisTime < BridgeAnalysisInterval))
+		{
+			continue;
+		}
+
+		const FIntVector CenterCluster = FVoxelConnectivityGraph::GetClusterCoord(Regions.LastEditVoxel);
+		const FIntVector ClusterMin = CenterCluster - FIntVector(BridgeAnalysisRadiusClusters);
+		const FIntVector ClusterMax = CenterCluster + FIntVector(BridgeAnalysisRadiusClusters);
+		const FVoxelIslandDetectionSettings Settings = MakeDetectionSettings(World);
+
+		Regions.BeginAnalysis();
+		Regions.LastAnalysisTime = Now;
+
+		TVoxelSharedPtr<FVoxelData> Data = World->GetDataSharedPtr();
+		TWeakObjectPtr<UVoxelIslandPhysics> WeakThis(this);
+		TWeakObjectPtr<AVoxelWorld> WeakWorld(World);
+
+		Async(EAsyncExecution::ThreadPool, [Data, Settings, ClusterMin, ClusterMax, WeakThis, WeakWorld]()
+		{
+			// A private graph: the game thread one is mutated by checks while this runs
+			FVoxelConnectivityGraph Graph;
+			TSet<FIntVector> WeakClusters;
+			Graph.FindWeakClusters(*Data, ClusterMin, ClusterMax, Settings, WeakClusters);
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, WeakWorld, ClusterMin, ClusterMax, WeakClusters = MoveTemp(WeakClusters)]() mutable
+			{
+				UVoxelIslandPhysics* This = WeakThis.Get();
+				if (!This)
+				{
+					return;
+				}
+
+				FBridgeRegions* Regions = This->BridgeRegions.Find(WeakWorld);
+				if (!Regions)
+				{
+					return;
+				}
+
+				Regions->FinishAnalysis(ClusterMin, ClusterMax, MoveTemp(WeakClusters));
+			});
+		});
+	}
+}
+
+bool UVoxelIslandPhysics::IsIslandStillPresent(AVoxelWorld* World, const FVoxelIsland& Island) const
+{
+	if (Island.Voxels.Num() == 0)
+	{
+		return false;
+	}
+
+	const int32 SolidCount = FVoxelIslandDetector::CountSolidVoxels(World->GetData(), Island);
+
+	// Tolerate small nibbles at the edge of the island, reject anything that was substantially edited
+	return SolidCount >= Island.Voxels.Num() * 9 / 10;
+}
+
+void UVoxelIslandPhysics::ProcessDetectedIslands(AVoxelWorld* World, const TArray<FVoxelIsland>& DetectedIslands, const FVector& EditLocation)
+{
+	// Only create falling worlds for ungrounded islands, all of one cut in a single batch
+	TArray<FVoxelIsland> FallingIslands;
+	for (const FVoxelIsland& Island : DetectedIslands)
+	{
+		if (!Island.bIsGrounded && Island.Voxels.Num() > 0)
+		{
+			FallingIslands.Add(Island);
+		}
+		else if (Island.bIsGrounded)
+		{
+			UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: Island with %d voxels is grounded, leaving in place"), 
+				Island.Voxels.Num());
+		}
+	}
+
+	if (FallingIslands.Num() > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Creating falling worlds for %d islands"), FallingIslands.Num());
+		CreateFallingVoxelWorlds(World, FallingIslands, EditLocation);
+	}
+	
+	if (DetectedIslands.Num() == 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("VoxelIslandPhysics: No islands detected in edit area"));
+	}
+
+	OnIslandsDetected.Broadcast(World, DetectedIslands);
+}
+
+bool UVoxelIslandPhysics::HasVoxelAt(const FVoxelOccupancyBuffer& Occupancy, const FIntVector& Position) const
+{
+	// Outside the buffer counts as empty, same as an unread voxel
+	return Occupancy.Contains(Position) && Occupancy.IsSolid(Position);
+}
+
+AVoxelWorld* UVoxelIslandPhysics::CreateFallingVoxelWorldInternal(
+	const FIntVector& WorldSize,
+	float InVoxelSize,
+	const FTransform& DesiredTransform,
+	UMaterialInterface* VoxelMat)
+{
+	const int32 SizeClass = GetFallingWorldSizeClass(WorldSize.X);
+	if (SizeClass != INDEX_NONE)
+	{
+		if (AVoxelWorld* PooledWorld = AcquirePooledFallingWorld(SizeClass, InVoxelSize, DesiredTransform))
+		{
+			return PooledWorld;
+		}
+
+		// Pool ran dry: spawn at the class size so the world can join the pool once its island is gone
+		UE_LOG(LogTemp, Warning, TEXT("[FallingWorldPool] No pooled world of size %d left, spawning one"), SizeClass);
+		return SpawnFallingVoxelWorld(FIntVector(SizeClass), InVoxelSize, DesiredTransform, VoxelMat);
+	}
+
+	return SpawnFallingVoxelWorld(WorldSize, InVoxelSize, DesiredTransform, VoxelMat);
+}
+
+AVoxelWorld* UVoxelIslandPhysics::SpawnFallingVoxelWorld(
+	const FIntVector& WorldSize,
+	float InVoxelSize,
+	const FTransform& DesiredTransform,
+	UMaterialInterface* VoxelMat)
+{
+	AVoxelWorld* W = GetWorld()->SpawnActor<AVoxelWorld>(AVoxelWorld::StaticClass(), FTransform::Identity);
+	if (!W) { return nullptr; }
+
+	// Tag for your tool routing (keep behavior the same)
+	W->Tags.Add(FName("FallingVoxelWorld"));
+
+	// 1) Configure BEFORE CreateWorld()
+	W->bCreateWorldAutomatically = false;
+	// If your plugin expects cubic, use X; otherwise set each dimension via appropriate API.
+	W->WorldSizeInVoxel = WorldSize.X;
+	W->VoxelSize        = InVoxelSize;
+	
+	// PERFORMANCE: Adjust settings for large falling worlds if needed
+	// Only reduce detail for very large worlds to avoid octree limits
+	if (WorldSize.X > 1500)
+	{
+		W->RenderOctreeDepth = FMath::Min(W->RenderOctreeDepth, 8); // Reduce render depth only for huge worlds
+		W->MaxLOD = FMath::Max(W->MaxLOD, 2); // Slight LOD increase for massive structures
+	}
+
+	// Generator setup - falling worlds have no procedural generation so they're empty. Only the island
+	// exists, either copied into the data or served from its snapshot by the snapshot generator.
+	if (bShareIslandSnapshots)
+	{
+		W->Generator = NewObject<UVoxelIslandSnapshotGenerator>(W);
+	}
+	else
+	{
+		W->Generator = nullptr;
+	}
+	// If you're using a collection/material, set them here (keep your existing logic)
+	if (VoxelMat)
+	{
+		// Set up material collection for MultiIndex
+		W->MaterialConfig = EVoxelMaterialConfig::MultiIndex;
+		
+		UVoxelBasicMaterialCollection* Collection = NewObject<UVoxelBasicMaterialCollection>(W);
+		FVoxelBasicMaterialCollectionLayer Layer;
+		Layer.LayerIndex = 0;
+		Layer.LayerMaterial = VoxelMat;
+		Collection->Layers.Add(Layer);
+		Collection->InitializeCollection();
+		
+		W->MaterialCollection = Collection;
+		W->VoxelMaterial = VoxelMat; // matches your material discovery path
+	}
+
+	// Place actor now so world-space bounds are correct when created
+	W->SetActorTransform(DesiredTransform);
+	
+	// Add VoxelIslandPhysics component to the falling world and copy settings
+	UVoxelIslandPhysics* FallingPhysics = NewObject<UVoxelIslandPhysics>(W);
+	W->AddInstanceComponent(FallingPhysics);
+	FallingPhysics->RegisterComponent();
+	
+	// Copy island detection settings from this component
+	FallingPhysics->SearchPadding = this->SearchPadding;
+	FallingPhysics->MaxFloodFillIterations = this->MaxFloodFillIterations;
+	FallingPhysics->MaxTotalVoxels = this->MaxTotalVoxels;
+	FallingPhysics->MaxQuickScanVoxels = this->MaxQuickScanVoxels;
+	FallingPhysics->TowerHeightLimit = this->TowerHeightLimit;
+	FallingPhysics->bUseBrickLabeling = this->bUseBrickLabeling;
+	
+	UE_LOG(LogTemp, Warning, TEXT("[FallingWorld] Copied island detection settings: SearchPadding=%d, MaxFloodFill=%d, MaxTotalVoxels=%d"), 
+		FallingPhysics->SearchPadding, FallingPhysics->MaxFloodFillIterations, FallingPhysics->MaxTotalVoxels);
+
+	ConfigureFallingWorldCollision(W);
+
+	// 2) Create the world – this computes bounds internally
+	W->CreateWorld();
+
+	// 3) Add an invoker AFTER world exists - with dynamic range calculation
+	UVoxelSimpleInvokerComponent* Inv = NewObject<UVoxelSimpleInvokerComponent>(W);
+	if (Inv)
+	{
+		// TOWER FIX: Calculate LOD range dynamically based on world size
+		float WorldSizeInCm = WorldSize.X * InVoxelSize;
+		float DynamicLODRange = FMath::Max(WorldSizeInCm * 1.5f, 30000.0f); // 1.5x world size, min 300m
+		
+		UE_LOG(LogTemp, Warning, TEXT("[TowerFix] WorldSize=%d, WorldSizeInCm=%.1f, DynamicLODRange=%.1f"), 
+			WorldSize.X, WorldSizeInCm, DynamicLODRange);
+		
+		Inv->RegisterComponent();
+		Inv->AttachToComponent(W->GetRootComponent(), FAttachmentTransformRules::KeepWorldTransform);
+		Inv->LODRange        = DynamicLODRange;
+		Inv->CollisionsRange = DynamicLODRange;
+		Inv->SetActive(true);
+	}
+
+	// 4) Kick renderer - no need for debug seed, real island data will generate triangles
+	W->RecreateRender();
+	FTimerHandle LODHandle;
+	W->GetWorld()->GetTimerManager().SetTimer(LODHandle, [W]()
+	{
+		if (!IsValid(W)) return;
+		// If your plugin exposes a safer API, call it; this mirrors your existing approach.
+		W->GetLODManager().ForceLODsUpdate();
+	}, 0.05f, false);
+
+	return W;
+}
+
+void UVoxelIslandPhysics::ConfigureFallingWorldCollision(AVoxelWorld* W)
+{
+	// Enable physics and set collision trace flag for proper physics collision mesh
+	W->bEnableCollisions = true;
+	W->bComputeVisibleChunksCollisions = true;
+	
+	// Set collision trace flag to UseComplexAsSimple for voxel physics
+	// This ensures the physics cooker creates proper collision meshes
+	W->GetWorldRoot().SetCollisionObjectType(ECC_WorldDynamic);
+	W->GetWorldRoot().SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	W->GetWorldRoot().SetCollisionResponseToAllChannels(ECR_Block);
+	W->GetWorldRoot().BodyInstance.SetCollisionProfileName("BlockAll");
+	W->GetWorldRoot().BodyInstance.bUseCCD = true; // Continuous collision detection for fast moving objects
+	
+	// Set collision trace type to use simple collision as complex for voxel physics
+	W->GetWorldRoot().SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Block);
+	W->GetWorldRoot().SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Block);
+	
+	// Configure the body instance for simple as complex collision
+	W->GetWorldRoot().BodyInstance.SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	W->GetWorldRoot().BodyInstance.SetObjectType(ECC_WorldDynamic);
+	
+	// Set collision complexity to use complex collision as simple (as expected by physics cooker)
+	if (UBodySetup* BodySetup = W->GetWorldRoot().GetBodySetup())
+	{
+		BodySetup->CollisionTraceFlag = ECollisionTraceFlag::CTF_UseComplexAsSimple;
+		BodySetup->InvalidatePhysicsData();
+		BodySetup->CreatePhysicsMeshes();
+	}
+}
+
+UMaterialInterface* UVoxelIslandPhysics::LoadFallingWorldMaterial() const
+{
+	UMaterialInterface* VoxelMat = LoadObject<UMaterialInterface>(
+		nullptr,
+		TEXT("/Voxel/Examples/Materials/Quixel/MI_VoxelQuixel_FiveWayBlend_Inst.MI_VoxelQuixel_FiveWayBlend_Inst"));
+
+	if (!VoxelMat)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[CreateFallingVoxelWorld] Failed to load Quixel material"));
+	}
+	return VoxelMat;
+}
+
+void UVoxelIslandPhysics::WarmFallingWorldPool()
+{
+	AVoxelWorld* OwnerWorld = Cast<AVoxelWorld>(GetOwner());
+	if (!OwnerWorld || !GetWorld() || FallingWorldsPerSizeClass <= 0)
+	{
+		return;
+	}
+
+	UMaterialInterface* VoxelMat = LoadFallingWorldMaterial();
+	if (!VoxelMat)
+	{
+		return;
+	}
+
+	// Parked next to the owner until an island needs them
+	const double StartTime = FPlatformTime::Seconds();
+	const FTransform ParkTransform(FRotator::ZeroRotator, OwnerWorld->GetActorLocation(), FVector::OneVector);
+	int32 NumWarmed = 0;
+	for (const int32 SizeClass : FallingWorldPoolSizeClasses)
+	{
+		if (SizeClass <= 0)
+		{
+			continue;
+		}
+
+		for (int32 Index = 0; Index < FallingWorldsPerSizeClass; Index++)
+		{
+			AVoxelWorld* W = SpawnFallingVoxelWorld(FIntVector(SizeClass), OwnerWorld->VoxelSize, ParkTransform, VoxelMat);
+			if (!W)
+			{
+				UE_LOG(LogTemp, Error, TEXT("[FallingWorldPool] Failed to spawn pooled world of size %d"), SizeClass);
+				continue;
+			}
+
+			ParkFallingVoxelWorld(W);
+			PooledFallingWorlds.Add(W);
+			NumWarmed++;
+		}
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("[FallingWorldPool] Warmed %d falling worlds in %d size classes (%.1fms)"),
+		NumWarmed, FallingWorldPoolSizeClasses.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+int32 UVoxelIslandPhysics::GetFallingWorldSizeClass(int32 RequiredWorldSize) const
+{
+	if (!bPoolFallingWorlds)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 BestSizeClass = INDEX_NONE;
+	for (const int32 SizeClass : FallingWorldPoolSizeClasses)
+	{
+		if (SizeClass >= RequiredWorldSize && (BestSizeClass == INDEX_NONE || SizeClass < BestSizeClass))
+		{
+			BestSizeClass = SizeClass;
+		}
+	}
+	return BestSizeClass;
+}
+
+AVoxelWorld* UVoxelIslandPhysics::AcquirePooledFallingWorld(int32 SizeClass, float InVoxelSize, const FTransform& DesiredTransform)
+{
+	for (int32 Index = PooledFallingWorlds.Num() - 1; Index >= 0; Index--)
+	{
+		AVoxelWorld* W = PooledFallingWorlds[Index];
+		if (!IsValid(W) || !W->IsCreated())
+		{
+			PooledFallingWorlds.RemoveAtSwap(Index);
+			continue;
+		}
+
+		if (W->WorldSizeInVoxel != SizeClass || !FMath::IsNearlyEqual(W->VoxelSize, InVoxelSize))
+		{
+			continue;
+		}
+
+		PooledFallingWorlds.RemoveAtSwap(Index);
+
+		// Reset: move to the island, show it again and undo the collision changes the last island's physics made.
+		// The data was emptied when the world was released.
+		W->SetActorTransform(DesiredTransform);
+		W->SetActorHiddenInGame(false);
+		W->SetActorEnableCollision(true);
+		ConfigureFallingWorldCollision(W);
+		CopyIslandDetectionSettings(W);
+
+		UE_LOG(LogTemp, Warning, TEXT("[FallingWorldPool] Reusing pooled world of size %d (%d left in pool)"), SizeClass, PooledFallingWorlds.Num());
+		return W;
+	}
+
+	return nullptr;
+}
+
+void UVoxelIslandPhysics::ReleaseFallingVoxelWorld(AVoxelWorld* World)
+{
+	if (!IsValid(World))
+	{
+		return;
+	}
+
+	int32 NumParked = 0;
+	for (AVoxelWorld* PooledWorld : PooledFallingWorlds)
+	{
+		if (IsValid(PooledWorld) && PooledWorld->WorldSizeInVoxel == World->WorldSizeInVoxel)
+		{
+			NumParked++;
+		}
+	}
+
+	if (!bPoolFallingWorlds || !World->IsCreated() || !FallingWorldPoolSizeClasses.Contains(World->WorldSizeInVoxel) || NumParked >= FallingWorldsPerSizeClass)
+	{
+		ForgetVoxelWorld(World);
+		World->Destroy();
+		return;
+	}
+
+	// Drop every edited chunk instead of recreating the world: the copied island, its materials and
+	// anything built onto it after landing, wherever that reaches. A shared snapshot is dropped too.
+	if (UVoxelIslandSnapshotGenerator* SnapshotGenerator = Cast<UVoxelIslandSnapshotGenerator>(World->Generator.GetObject()))
+	{
+		SnapshotGenerator->SetSnapshot(nullptr);
+	}
+	World->GetData().ClearData();
+
+	// Caches about the old island must not answer checks on the next one
+	ForgetVoxelWorld(World);
+	if (UVoxelIslandPhysics* FallingPhysics = World->FindComponentByClass<UVoxelIslandPhysics>())
+	{
+		FallingPhysics->ForgetVoxelWorld(World);
+	}
+
+	// Invokers sized for the old island; the one added at spawn covers the whole world and stays
+	TArray<UVoxelSimpleInvokerComponent*> Invokers;
+	World->GetComponents(Invokers);
+	for (UVoxelSimpleInvokerComponent* Invoker : Invokers)
+	{
+		if (Invoker && Invoker->ComponentHasTag(FName("IslandInvoker")))
 		{
-			FIntVector Neighbor = Current + Directions[DirIdx];
-			
-			if (Visited.Contains(Neighbor))
-			{
-				continue;
-			}
-
-			// Check if neighbor is solid
-			FVoxelValue NeighborValue = World->GetData().GetValue(Neighbor, 0);
-			if (!NeighborValue.IsEmpty())
-			{
-				Queue.Add(Neighbor);
-				Visited.Add(Neighbor);
-			}
+			World->RemoveInstanceComponent(Invoker);
+			Invoker->DestroyComponent();
 		}
 	}
 
-	return false; // No path to ground found
+	ParkFallingVoxelWorld(World);
+	PooledFallingWorlds.Add(World);
+
+	UE_LOG(LogTemp, Log, TEXT("[FallingWorldPool] Returned world of size %d to the pool (%d pooled)"), World->WorldSizeInVoxel, PooledFallingWorlds.Num());
 }
 
-bool UVoxelIslandPhysics::HasVoxelAt(AVoxelWorld* World, const FIntVector& Position)
+void UVoxelIslandPhysics::ParkFallingVoxelWorld(AVoxelWorld* World)
 {
-	if (!World || !World->IsCreated())
-	{
-		return false;
-	}
-	
-	// Get voxel data accessor
-	FVoxelReadScopeLock Lock(World->GetData(), FVoxelIntBox(Position, Position + FIntVector(1)), "IslandCheck");
-	
-	// Check if voxel is solid
-	FVoxelValue Value = World->GetData().GetValue(Position, 0);
-	return Value.IsEmpty() == false;
+	World->GetWorldRoot().SetSimulatePhysics(false);
+	World->SetActorEnableCollision(false);
+	World->SetActorHiddenInGame(true);
 }
 
-AVoxelWorld* UVoxelIslandPhysics::CreateFallingVoxelWorldInternal(
-	const FIntVector& WorldSize,
-	float InVoxelSize,
-	const FTransform& DesiredTransform,
-	UMaterialInterface* VoxelMat)
+void UVoxelIslandPhysics::ForgetVoxelWorld(AVoxelWorld* World)
 {
-	// Clean up any existing falling worlds
-	for (AVoxelWorld* ExistingWorld : FallingVoxelWorlds)
-	{
-		if (IsValid(ExistingWorld))
+	ConnectivityGraphs.Remove(World);
+	OccupancyPyramids.Remove(World);
+	ResultCaches.Remove(World);
+	GroundAnchors.Remove(World);
+	BridgeRegions.Remove(World);
+	QueuedIslandChecks.RemoveAll([World](const FQueuedIslandCheck& Check) { return Check.World.Get() == World; });
+	DetectionJobs.RemoveAll([World](const FPendingDetectionJob& Pending) { return Pending.World.Get() == World; });
+	for (auto It = AsyncDetections.CreateIterator(); It; ++It)
+	{
+		if (It.Value().World.Get() == World)
 		{
-			ExistingWorld->Destroy();
+			It.RemoveCurrent();
 		}
 	}
-	FallingVoxelWorlds.Empty();
-	
-	AVoxelWorld* W = GetWorld()->SpawnActor<AVoxelWorld>(AVoxelWorld::StaticClass(), FTransform::Identity);
-	if (!W) { return nullptr; }
+}
 
-	// Tag for your tool routing (keep behavior the same)
-	W->Tags.Add(FName("FallingVoxelWorld"));
+void UVoxelIslandPhysics::RemoveFallingWorldAt(int32 Index)
+{
+	FallingVoxelWorlds.RemoveAt(Index);
+	// Always remove from all arrays at the same index to maintain synchronization
+	if (Index < FallingVelocities.Num()) FallingVelocities.RemoveAt(Index);
+	if (Index < bCustomPhysicsEnabled.Num()) bCustomPhysicsEnabled.RemoveAt(Index);
+	if (Index < bProxyDirty.Num()) bProxyDirty.RemoveAt(Index);
+	if (Index < LastEditTime.Num()) LastEditTime.RemoveAt(Index);
+	if (Index < bSettled.Num()) bSettled.RemoveAt(Index);
+	if (Index < SettleTimers.Num()) SettleTimers.RemoveAt(Index);
+	if (Index < ProxyCookCounts.Num()) ProxyCookCounts.RemoveAt(Index);
+	if (Index < ProxyRebuildTimers.Num()) ProxyRebuildTimers.RemoveAt(Index);
+}
 
-	// 1) Configure BEFORE CreateWorld()
-	W->bCreateWorldAutomatically = false;
-	// If your plugin expects cubic, use X; otherwise set each dimension via appropriate API.
-	W->WorldSizeInVoxel = WorldSize.X;
-	W->VoxelSize        = InVoxelSize;
-	
-	// PERFORMANCE: Adjust settings for large falling worlds if needed
-	// Only reduce detail for very large worlds to avoid octree limits
-	if (WorldSize.X > 1500)
+void UVoxelIslandPhysics::CreateFallingVoxelWorlds(AVoxelWorld* SourceWorld, const TArray<FVoxelIsland>& Islands, const FVector& EditLocation)
+{
+	if (!SourceWorld || !GetWorld() || Islands.Num() == 0)
 	{
-		W->RenderOctreeDepth = FMath::Min(W->RenderOctreeDepth, 8); // Reduce render depth only for huge worlds
-		W->MaxLOD = FMath::Max(W->MaxLOD, 2); // Slight LOD increase for massive structures
+		return;
 	}
 
-	// Generator setup - falling worlds should have NO generator so they're empty
-	// Only the copied voxel data should exist, no procedural generation
-	W->Generator = nullptr;
-	// If you're using a collection/material, set them here (keep your existing logic)
-	if (VoxelMat)
-	{
-		// Set up material collection for MultiIndex
-		W->MaterialConfig = EVoxelMaterialConfig::MultiIndex;
-		
-		UVoxelBasicMaterialCollection* Collection = NewObject<UVoxelBasicMaterialCollection>(W);
-		FVoxelBasicMaterialCollectionLayer Layer;
-		Layer.LayerIndex = 0;
-		Layer.LayerMaterial = VoxelMat;
-		Collection->Layers.Add(Layer);
-		Collection->InitializeCollection();
-		
-		W->MaterialCollection = Collection;
-		W->VoxelMaterial = VoxelMat; // matches your material discovery path
+	// Load material for the falling worlds
+	UMaterialInterface* VoxelMat = LoadFallingWorldMaterial();
+	if (!VoxelMat) 
+	{ 
+		return; 
 	}
 
-	// Place actor now so world-space bounds are correct when created
-	W->SetActorTransform(DesiredTransform);
-	
-	// Add VoxelIslandPhysics component to the falling world and copy settings
-	UVoxelIslandPhysics* FallingPhysics = NewObject<UVoxelIslandPhysics>(W);
-	W->AddInstanceComponent(FallingPhysics);
-	FallingPhysics->RegisterComponent();
-	
-	// Copy island detection settings from this component
-	FallingPhysics->SearchPadding = this->SearchPadding;
-	FallingPhysics->MaxFloodFillIterations = this->MaxFloodFillIterations;
-	FallingPhysics->MaxTotalVoxels = this->MaxTotalVoxels;
-	FallingPhysics->MaxQuickScanVoxels = this->MaxQuickScanVoxels;
-	FallingPhysics->TowerHeightLimit = this->TowerHeightLimit;
-	
-	UE_LOG(LogTemp, Warning, TEXT("[FallingWorld] Copied island detection settings: SearchPadding=%d, MaxFloodFill=%d, MaxTotalVoxels=%d"), 
-		FallingPhysics->SearchPadding, FallingPhysics->MaxFloodFillIterations, FallingPhysics->MaxTotalVoxels);
-
-	// Enable physics and set collision trace flag for proper physics collision mesh
-	W->bEnableCollisions = true;
-	W->bComputeVisibleChunksCollisions = true;
-	
-	// Set collision trace flag to UseComplexAsSimple for voxel physics
-	// This ensures the physics cooker creates proper collision meshes
-	W->GetWorldRoot().SetCollisionObjectType(ECC_WorldDynamic);
-	W->GetWorldRoot().SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-	W->GetWorldRoot().SetCollisionResponseToAllChannels(ECR_Block);
-	W->GetWorldRoot().BodyInstance.SetCollisionProfileName("BlockAll");
-	W->GetWorldRoot().BodyInstance.bUseCCD = true; // Continuous collision detection for fast moving objects
-	
-	// Set collision trace type to use simple collision as complex for voxel physics
-	W->GetWorldRoot().SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Block);
-	W->GetWorldRoot().SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Block);
-	
-	// Configure the body instance for simple as complex collision
-	W->GetWorldRoot().BodyInstance.SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-	W->GetWorldRoot().BodyInstance.SetObjectType(ECC_WorldDynamic);
-	
-	// Set collision complexity to use complex collision as simple (as expected by physics cooker)
-	if (UBodySetup* BodySetup = W->GetWorldRoot().GetBodySetup())
+	// Largest first, so islands left over at the cap are the small ones
+	TArray<const FVoxelIsland*> SortedIslands;
+	for (const FVoxelIsland& Island : Islands)
 	{
-		BodySetup->CollisionTraceFlag = ECollisionTraceFlag::CTF_UseComplexAsSimple;
-		BodySetup->InvalidatePhysicsData();
-		BodySetup->CreatePhysicsMeshes();
+		SortedIslands.Add(&Island);
 	}
+	SortedIslands.Sort([](const FVoxelIsland& A, const FVoxelIsland& B) { return A.Voxels.Num() > B.Voxels.Num(); });
 
-	// 2) Create the world – this computes bounds internally
-	W->CreateWorld();
+	TArray<const FVoxelIsland*> CreatedIslands;
+	TArray<AVoxelWorld*> CreatedWorlds;
+	FIntVector CarvedMin(MAX_int32);
+	FIntVector CarvedMax(MIN_int32);
+	for (const FVoxelIsland* Island : SortedIslands)
+	{
+		// T6: make room by evicting islands from earlier cuts, never ones from this batch
+		while (!CanCreateNewIsland() && FallingVoxelWorlds.Num() > CreatedWorlds.Num())
+		{
+			CleanupOldestIsland();
+		}
+		if (!CanCreateNewIsland())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[CreateFallingVoxelWorlds] Performance cap reached, leaving %d islands in place"),
+				SortedIslands.Num() - CreatedWorlds.Num());
+			break;
+		}
 
-	// 3) Add an invoker AFTER world exists - with dynamic range calculation
-	UVoxelSimpleInvokerComponent* Inv = NewObject<UVoxelSimpleInvokerComponent>(W);
-	if (Inv)
+		AVoxelWorld* W = CreateFallingVoxelWorld(SourceWorld, *Island, VoxelMat);
+		if (!W)
+		{
+			continue;
+		}
+
+		CreatedIslands.Add(Island);
+		CreatedWorlds.Add(W);
+	}
+
+	if (CreatedWorlds.Num() == 0)
 	{
-		// TOWER FIX: Calculate LOD range dynamically based on world size
-		float WorldSizeInCm = WorldSize.X * InVoxelSize;
-		float DynamicLODRange = FMath::Max(WorldSizeInCm * 1.5f, 30000.0f); // 1.5x world size, min 300m
-		
-		UE_LOG(LogTemp, Warning, TEXT("[TowerFix] WorldSize=%d, WorldSizeInCm=%.1f, DynamicLODRange=%.1f"), 
-			WorldSize.X, WorldSizeInCm, DynamicLODRange);
-		
-		Inv->RegisterComponent();
-		Inv->AttachToComponent(W->GetRootComponent(), FAttachmentTransformRules::KeepWorldTransform);
-		Inv->LODRange        = DynamicLODRange;
-		Inv->CollisionsRange = DynamicLODRange;
-		Inv->SetActive(true);
+		return;
 	}
 
-	// 4) Kick renderer - no need for debug seed, real island data will generate triangles
-	W->RecreateRender();
-	FTimerHandle LODHandle;
-	W->GetWorld()->GetTimerManager().SetTimer(LODHandle, [W]()
+	// ATOMIC SWAP: Remove every island from the source in the same frame their falling worlds appear,
+	// then update the source once over the region the removals wrote
+	for (const FVoxelIsland* Island : CreatedIslands)
 	{
-		if (!IsValid(W)) return;
-		// If your plugin exposes a safer API, call it; this mirrors your existing approach.
-		W->GetLODManager().ForceLODsUpdate();
-	}, 0.05f, false);
+		FIntVector DirtyMin, DirtyMax;
+		if (RemoveIslandVoxels(SourceWorld, *Island, DirtyMin, DirtyMax))
+		{
+			CarvedMin = FIntVector(FMath::Min(CarvedMin.X, DirtyMin.X), FMath::Min(CarvedMin.Y, DirtyMin.Y), FMath::Min(CarvedMin.Z, DirtyMin.Z));
+			CarvedMax = FIntVector(FMath::Max(CarvedMax.X, DirtyMax.X), FMath::Max(CarvedMax.Y, DirtyMax.Y), FMath::Max(CarvedMax.Z, DirtyMax.Z));
+		}
+	}
+	RebuildWorldCollisionRegional(SourceWorld, CarvedMin, CarvedMax, TEXT("SourceAfterCarve"));
 
-	return W;
+	FVoxelIsland CarvedRegion;
+	CarvedRegion.MinBounds = CarvedMin;
+	CarvedRegion.MaxBounds = CarvedMax;
+	AttachInvokers(SourceWorld, nullptr, CarvedRegion);
+	SyncRebuildWorlds(SourceWorld, nullptr, CarvedRegion);
+	LogRuntimeStats(SourceWorld, TEXT("SourceWorld"));
+
+	UE_LOG(LogTemp, Warning, TEXT("[CreateFallingVoxelWorlds] ATOMIC SWAP complete - %d islands carved/spawned, %d falling worlds live"),
+		CreatedWorlds.Num(), FallingVoxelWorlds.Num());
 }
 
-void UVoxelIslandPhysics::CreateFallingVoxelWorld(AVoxelWorld* SourceWorld, const FVoxelIsland& Island, const FVector& EditLocation)
+AVoxelWorld* UVoxelIslandPhysics::CreateFallingVoxelWorld(AVoxelWorld* SourceWorld, const FVoxelIsland& Island, UMaterialInterface* VoxelMat)
 {
-	if (!SourceWorld || !GetWorld())
-	{
-		return;
-	}
-	
 	// Calculate island size for proper world configuration
 	FIntVector IslandSize = Island.MaxBounds - Island.MinBounds + FIntVector(1);
 	int32 MaxDimension = FMath::Max3(IslandSize.X, IslandSize.Y, IslandSize.Z);
@@ -656,20 +1577,8 @@ void UVoxelIslandPhysics::CreateFallingVoxelWorld(AVoxelWorld* SourceWorld, cons
 	FVector LocalPosMin = FVector(Island.MinBounds) * SourceWorld->VoxelSize;
 	FVector WorldPosMin = SourceWorld->GetActorTransform().TransformPosition(LocalPosMin);
 	
-	// Load material for the falling world
-	UMaterialInterface* VoxelMat = LoadObject<UMaterialInterface>(
-		nullptr,
-		TEXT("/Voxel/Examples/Materials/Quixel/MI_VoxelQuixel_FiveWayBlend_Inst.MI_VoxelQuixel_FiveWayBlend_Inst"));
-	
-	if (!VoxelMat) 
-	{ 
-		UE_LOG(LogTemp, Error, TEXT("[CreateFallingVoxelWorld] Failed to load Quixel material")); 
-		return; 
-	}
-	
 	// Create the new world using the helper method
 	// Position the falling world exactly where the original material was located
-	const float V = SourceWorld->VoxelSize;
 	FTransform DesiredTransform(FRotator::ZeroRotator,
 		/* location: */ WorldPosMin,  // Position exactly where original island was
 		FVector::OneVector);
@@ -678,57 +1587,18 @@ void UVoxelIslandPhysics::CreateFallingVoxelWorld(AVoxelWorld* SourceWorld, cons
 	if (!W)
 	{
 		UE_LOG(LogTemp, Error, TEXT("[CreateFallingVoxelWorld] Failed to create falling voxel world"));
-		return;
+		return nullptr;
 	}
 	
-	// DON'T add to FallingVoxelWorlds here - that will be done atomically with physics setup!
-	// Store pending data for the atomic initialization
-	PendingSourceWorld = SourceWorld;
-	PendingIsland = Island;
-	PendingWorldPosMin = WorldPosMin;
-	PendingMeshWorld = W;
-	
-	UE_LOG(LogTemp, Warning, TEXT("[CreateFallingVoxelWorld] World created but NOT yet added to tracking arrays - pending atomic setup"));
-	
-	// IMMEDIATE SIMULTANEOUS SWAP: Remove old piece and show new piece at the same time
-	
-	// First, prepare the new world but don't show it yet
-	PendingMeshWorld->RecreateRender();
-	PendingMeshWorld->GetLODManager().ForceLODsUpdate();
-	
-	// Copy island data to new world (invisible for now)
-	CopyVoxelData(PendingSourceWorld, PendingMeshWorld, PendingIsland, PendingWorldPosMin);
-	UE_LOG(LogTemp, Warning, TEXT("[VoxelCopy] Copied %d voxels from source to falling world"), PendingIsland.VoxelPositions.Num());
-	RebuildWorldCollision(PendingMeshWorld, TEXT("FallingAfterCopy"));
-	
-	// CRITICAL: Enable physics and collision now that voxel data and mesh are ready
-	EnablePhysicsWithGuards(PendingMeshWorld, PendingIsland);
-	
-	// Validate collision geometry covers the full shape
-	ValidateVoxelCollision(PendingMeshWorld, TEXT("FallingWorld"));
-	
-	UE_LOG(LogTemp, Warning, TEXT("[VoxelCopy] Physics and collision enabled for falling world"));
-	
-	// Debug: Log exact positions for comparison
-	FVector SourceCenter = SourceWorld->GetActorLocation();
-	FVector FallingCenter = PendingMeshWorld->GetActorLocation();
-	UE_LOG(LogTemp, Warning, TEXT("[Position Debug] SourceWorld at %s, FallingWorld at %s, Offset=%s"), 
-		*SourceCenter.ToString(), *FallingCenter.ToString(), *(FallingCenter - SourceCenter).ToString());
-	
-	// ATOMIC SWAP: Remove from source and enable falling world simultaneously
-	RemoveIslandVoxels(PendingSourceWorld, PendingIsland);
-	RebuildWorldCollisionRegional(PendingSourceWorld, PendingIsland, TEXT("SourceAfterCarve"));
+	// Its renderer was created with the world (at spawn or when the pool was warmed), so only the LODs need refreshing
+	W->GetLODManager().ForceLODsUpdate();
 	
-	// Enable physics and make falling world visible
-	AttachInvokers(PendingSourceWorld, PendingMeshWorld, PendingIsland);
-	SyncRebuildWorlds(PendingSourceWorld, PendingMeshWorld, PendingIsland);
-	VerifyRuntimeStats(PendingSourceWorld, PendingMeshWorld, PendingIsland);
-	// ATOMIC FIX: Don't enable physics here - it will be done atomically later in ContinueWithIslandCopy
-	// EnablePhysicsIfValid(PendingMeshWorld, PendingIsland);
+	// Copy island data to new world
+	CopyVoxelData(SourceWorld, W, Island, WorldPosMin);
+	UE_LOG(LogTemp, Warning, TEXT("[VoxelCopy] Copied %d voxels from source to falling world"), Island.Voxels.Num());
+	RebuildWorldCollision(W, TEXT("FallingAfterCopy"));
 	
-	UE_LOG(LogTemp, Warning, TEXT("[CreateFallingVoxelWorld] Physics will be enabled atomically during copy process"));
-	
-	// CRITICAL FIX: Add world to tracking system immediately so custom physics can manage it
+	// CRITICAL FIX: Add world to tracking system before physics setup so custom physics can manage it
 	// even if mesh generation fails initially
 	int32 NewWorldIndex = FallingVoxelWorlds.Num();
 	
@@ -743,7 +1613,7 @@ void UVoxelIslandPhysics::CreateFallingVoxelWorld(AVoxelWorld* SourceWorld, cons
 	ProxyRebuildTimers.SetNumZeroed(NewWorldIndex + 1);
 	
 	// Now add the world - arrays are properly sized
-	FallingVoxelWorlds.Add(PendingMeshWorld);
+	FallingVoxelWorlds.Add(W);
 	
 	// Set initial physics state - enable immediately so custom physics can manage the world
 	bCustomPhysicsEnabled[NewWorldIndex] = true;  // Enable custom physics right away
@@ -752,12 +1622,24 @@ void UVoxelIslandPhysics::CreateFallingVoxelWorld(AVoxelWorld* SourceWorld, cons
 	
 	UE_LOG(LogTemp, Warning, TEXT("[CreateFallingVoxelWorld] Added world to tracking arrays at index %d with physics enabled"), NewWorldIndex);
 	
-	// NOTE: Collision setup moved to after voxel data copy in async callback
-	// EnablePhysicsWithGuards will be called after CopyVoxelData completes
+	// CRITICAL: Enable physics and collision now that voxel data and mesh are ready
+	EnablePhysicsWithGuards(W, Island);
+	
+	// Validate collision geometry covers the full shape
+	ValidateVoxelCollision(W, TEXT("FallingWorld"));
+	
+	// Debug: Log exact positions for comparison
+	FVector SourceCenter = SourceWorld->GetActorLocation();
+	FVector FallingCenter = W->GetActorLocation();
+	UE_LOG(LogTemp, Warning, TEXT("[Position Debug] SourceWorld at %s, FallingWorld at %s, Offset=%s"), 
+		*SourceCenter.ToString(), *FallingCenter.ToString(), *(FallingCenter - SourceCenter).ToString());
 	
-	UE_LOG(LogTemp, Warning, TEXT("[CreateFallingVoxelWorld] ATOMIC SWAP complete - simultaneous carve/spawn"));
+	// Make the falling world visible; the source side is done once for the whole batch
+	AttachInvokers(nullptr, W, Island);
+	SyncRebuildWorlds(nullptr, W, Island);
+	LogRuntimeStats(W, TEXT("FallingWorld"));
 	
-	UE_LOG(LogTemp, Warning, TEXT("[CreateFallingVoxelWorld] Created falling world, copy scheduled"));
+	return W;
 }
 
 
@@ -862,47 +1744,35 @@ void UVoxelIslandPhysics::ReadVoxelPayloadMultiIndex(AVoxelWorld* World, const F
 
 void UVoxelIslandPhysics::CopyVoxelData(AVoxelWorld* Source, AVoxelWorld* Destination, const FVoxelIsland& Island, const FVector& WorldPosMin)
 {
-	if (!Source || !Destination || Island.VoxelPositions.Num() == 0)
+	if (!Source || !Destination || Island.Voxels.Num() == 0)
 	{
 		return;
 	}
 	
-	// Get data locks
-	FVoxelReadScopeLock ReadLock(Source->GetData(), FVoxelIntBox::Infinite, "CopyRead");
-	FVoxelWriteScopeLock WriteLock(Destination->GetData(), FVoxelIntBox::Infinite, "CopyWrite");
-	
 	FIntVector MinIndex = Island.MinBounds;
 	
-	// Copy each voxel with border padding and explicit density/material
-	int32 CopiedCount = 0;
-	for (const FIntVector& SourcePos : Island.VoxelPositions)
+	// Read the island chunk by chunk, rebased so MinBounds lands on the destination origin. The transfer
+	// locks the island bounds only and masks out source voxels that are not part of the island, so the exact
+	// island shape is kept with its actual values rather than as a solid block.
+	const double StartTime = FPlatformTime::Seconds();
+	const TSharedRef<FVoxelIslandTransfer, ESPMode::ThreadSafe> Transfer = MakeShared<FVoxelIslandTransfer, ESPMode::ThreadSafe>();
+	Transfer->Read(Source->GetData(), Island, FIntVector::ZeroValue);
+	const int32 CopiedCount = Transfer->GetNumVoxels();
+	
+	// Worlds with a snapshot generator read the chunks in place, the others get them written into their data
+	UVoxelIslandSnapshotGenerator* SnapshotGenerator = bShareIslandSnapshots ? Cast<UVoxelIslandSnapshotGenerator>(Destination->Generator.GetObject()) : nullptr;
+	if (SnapshotGenerator)
 	{
-		// Get value and material from source
-		FVoxelValue Value = Source->GetData().GetValue(SourcePos, 0);
-		FVoxelMaterial Material = Source->GetData().GetMaterial(SourcePos, 0);
-		
-		// Rebase indices without border offset for exact shape copying
-		FIntVector DestPos = SourcePos - MinIndex;
-		
-		// CRITICAL: Copy the actual voxel value, not a fixed solid value
-		// This preserves the exact island shape instead of creating a solid block
-		Destination->GetData().SetValue(DestPos, Value);
-		Destination->GetData().SetMaterial(DestPos, Material);
-		
-		// Debug: Log first few copies with actual values
-		if (CopiedCount < 5)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[Copy] %d: Src(%d,%d,%d)->Dest(%d,%d,%d), Value=%.2f %s"), 
-				CopiedCount + 1,
-				SourcePos.X, SourcePos.Y, SourcePos.Z,
-				DestPos.X, DestPos.Y, DestPos.Z, 
-				Value.ToFloat(),
-				Value.IsEmpty() ? TEXT("(Empty)") : TEXT("(SOLID)"));
-		}
-		
-		CopiedCount++;
+		SnapshotGenerator->SetSnapshot(Transfer);
+	}
+	else
+	{
+		Transfer->Write(Destination->GetData());
 	}
 	
+	UE_LOG(LogTemp, Log, TEXT("[VoxelCopy] %d chunks %s in %.2fms (%lld KB)"),
+		Transfer->GetChunks().Num(), SnapshotGenerator ? TEXT("shared") : TEXT("transferred"),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0, Transfer->GetAllocatedSize() / 1024);
 	UE_LOG(LogTemp, Warning, TEXT("[VoxelCopy] Copied %d voxels with actual values (preserving original shape)"), CopiedCount);
 	
 	// CRITICAL: Force cache clearing and mesh regeneration for the copied region
@@ -924,8 +1794,8 @@ void UVoxelIslandPhysics::CopyVoxelData(AVoxelWorld* Source, AVoxelWorld* Destin
 	FVector LocalPosSrc = FVector(RefIdx) * VoxelSize;
 	FVector PsrcWorld = Source->GetActorTransform().TransformPosition(LocalPosSrc);
 	
-	// Falling world position of reference voxel (rebased with +1 border offset)
-	FVector LocalPosFall = FVector((RefIdx - MinIndex) + FIntVector(1, 1, 1)) * VoxelSize;
+	// Falling world position of reference voxel, rebased to where the transfer placed MinBounds
+	FVector LocalPosFall = FVector((RefIdx - MinIndex) + Transfer->GetDestMin()) * VoxelSize;
 	FVector PfallWorld = Destination->GetActorTransform().TransformPosition(LocalPosFall);
 	
 	float DeltaDistance = FVector::Dist(PsrcWorld, PfallWorld);
@@ -959,41 +1829,42 @@ void UVoxelIslandPhysics::CopyVoxelData(AVoxelWorld* Source, AVoxelWorld* Destin
 	UE_LOG(LogTemp, Warning, TEXT("[ForceMesh] Cleared cache for region (%d,%d,%d) to (%d,%d,%d)"),
 		RegionMin.X, RegionMin.Y, RegionMin.Z, RegionMax.X, RegionMax.Y, RegionMax.Z);
 	
-	UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Copied %d voxels to falling world with rebasing"), Island.VoxelPositions.Num());
+	UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Copied %d voxels to falling world with rebasing"), Island.Voxels.Num());
 }
 
-void UVoxelIslandPhysics::RemoveIslandVoxels(AVoxelWorld* World, const FVoxelIsland& Island)
+bool UVoxelIslandPhysics::RemoveIslandVoxels(AVoxelWorld* World, const FVoxelIsland& Island, FIntVector& OutDirtyMin, FIntVector& OutDirtyMax)
 {
-	if (!World || Island.VoxelPositions.Num() == 0)
+	if (!World || Island.Voxels.Num() == 0)
 	{
-		return;
+		return false;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("[Delete] Removing %d voxels from SourceWorld at exact indices set"), Island.VoxelPositions.Num());
-	
-	// Use scoped write lock for atomic edit
-	FVoxelWriteScopeLock WriteLock(World->GetData(), FVoxelIntBox::Infinite, "IslandDelete");
+	UE_LOG(LogTemp, Warning, TEXT("[Delete] Removing %d voxels from SourceWorld at exact indices set"), Island.Voxels.Num());
 	
-	// Remove each voxel by exact index (no loose AABB)
-	int32 RemovedCount = 0;
-	FIntVector MinPos(INT32_MAX), MaxPos(INT32_MIN);
+	// Clear by exact voxel set (no loose AABB), locking only the padded island bounds so meshing and
+	// collision elsewhere in the world are not blocked. Whole bricks go in box writes, the rest masked per brick.
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 NumBoxes = FVoxelIslandTransfer::Erase(World->GetData(), Island, OutDirtyMin, OutDirtyMax);
 	
-	for (const FIntVector& VoxelPos : Island.VoxelPositions)
+	UE_LOG(LogTemp, Warning, TEXT("[Delete] Carved bounds: Min=%s Max=%s (%d box writes, %.2fms)"),
+		*OutDirtyMin.ToString(), *OutDirtyMax.ToString(), NumBoxes, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	if (TUniquePtr<FVoxelConnectivityGraph>* Graph = ConnectivityGraphs.Find(World))
 	{
-		// Track bounds for debugging
-		MinPos = FIntVector(FMath::Min(MinPos.X, VoxelPos.X), FMath::Min(MinPos.Y, VoxelPos.Y), FMath::Min(MinPos.Z, VoxelPos.Z));
-		MaxPos = FIntVector(FMath::Max(MaxPos.X, VoxelPos.X), FMath::Max(MaxPos.Y, VoxelPos.Y), FMath::Max(MaxPos.Z, VoxelPos.Z));
-		
-		// Set to empty/air
-		World->GetData().SetValue(VoxelPos, FVoxelValue::Empty());
-		// Clear material too
-		World->GetData().SetMaterial(VoxelPos, FVoxelMaterial::Default());
-		RemovedCount++;
+		(*Graph)->Invalidate(OutDirtyMin, OutDirtyMax);
 	}
+	InvalidateOccupancyPyramid(World, OutDirtyMin, OutDirtyMax);
+	MarkResultCacheEdited(World, OutDirtyMin, OutDirtyMax);
+
+	// Detections still reading this box would find the erased island again: time-sliced jobs keep
+	// their chunk reads across ticks, async ones their snapshot
+	RestartOverlappingDetectionJobs(World, OutDirtyMin, OutDirtyMax);
+
+	// The removed material no longer holds anything up
+	MarkBridgeRegionsDirty(World, OutDirtyMin, OutDirtyMax);
 	
-	UE_LOG(LogTemp, Warning, TEXT("[Delete] Carved bounds: Min=%s Max=%s"), *MinPos.ToString(), *MaxPos.ToString());
-	
-	UE_LOG(LogTemp, Warning, TEXT("[Delete] Successfully removed %d/%d voxels from SourceWorld"), RemovedCount, Island.VoxelPositions.Num());
+	UE_LOG(LogTemp, Warning, TEXT("[Delete] Successfully removed %d voxels from SourceWorld"), Island.Voxels.Num());
+	return true;
 }
 
 void UVoxelIslandPhysics::RebuildWorldCollision(AVoxelWorld* World, const FString& WorldName)
@@ -1074,17 +1945,20 @@ void UVoxelIslandPhysics::RebuildWorldCollisionIncremental(AVoxelWorld* World, c
 
 void UVoxelIslandPhysics::RebuildWorldCollisionRegional(AVoxelWorld* World, const FVoxelIsland& Island, const FString& WorldName)
 {
-	if (!World || !World->IsCreated() || Island.VoxelPositions.Num() == 0)
+	if (Island.Voxels.Num() == 0)
 	{
 		return;
 	}
 	
-	// Calculate the bounds of the removed island with some padding
-	FIntVector MinPos(INT32_MAX), MaxPos(INT32_MIN);
-	for (const FIntVector& VoxelPos : Island.VoxelPositions)
+	// Bounds of the removed island, gathered at detection
+	RebuildWorldCollisionRegional(World, Island.MinBounds, Island.MaxBounds, WorldName);
+}
+
+void UVoxelIslandPhysics::RebuildWorldCollisionRegional(AVoxelWorld* World, const FIntVector& MinPos, const FIntVector& MaxPos, const FString& WorldName)
+{
+	if (!World || !World->IsCreated())
 	{
-		MinPos = FIntVector(FMath::Min(MinPos.X, VoxelPos.X), FMath::Min(MinPos.Y, VoxelPos.Y), FMath::Min(MinPos.Z, VoxelPos.Z));
-		MaxPos = FIntVector(FMath::Max(MaxPos.X, VoxelPos.X), FMath::Max(MaxPos.Y, VoxelPos.Y), FMath::Max(MaxPos.Z, VoxelPos.Z));
+		return;
 	}
 	
 	// Add padding for mesh generation (typically 2-3 voxels around the modified area)
@@ -1106,8 +1980,7 @@ void UVoxelIslandPhysics::RebuildWorldCollisionRegional(AVoxelWorld* World, cons
 	// Update collision only for the specific region
 	World->UpdateCollisionProfile();
 	
-	UE_LOG(LogTemp, Warning, TEXT("[%s Regional] Regional update completed for %d voxels in bounds"), 
-		*WorldName, Island.VoxelPositions.Num());
+	UE_LOG(LogTemp, Warning, TEXT("[%s Regional] Regional update completed"), *WorldName);
 }
 
 void UVoxelIslandPhysics::ValidateVoxelCollision(AVoxelWorld* World, const FString& WorldName)
@@ -1235,11 +2108,20 @@ void UVoxelIslandPhysics::EnablePhysicsWithGuards(AVoxelWorld* FallingWorld, con
 	}
 	
 	// Calculate mass from actual voxel count  
-	int32 VoxelCount = Island.VoxelPositions.Num();
+	int32 VoxelCount = Island.Voxels.Num();
 	float DensityPerVoxel = 0.01f;
 	float Mass = FMath::Clamp(VoxelCount * DensityPerVoxel, 10.0f, 10000.0f);
 	RootComp.SetMassOverrideInKg(NAME_None, Mass, true);
-	
+
+	// Inertia comes from the stats gathered at detection, not from the cooked body
+	if (VoxelCount > 0)
+	{
+		const double InertiaScale = double(Mass) / VoxelCount * FMath::Square(double(FallingWorld->VoxelSize));
+		const FVector Inertia = Island.InertiaDiagonal * InertiaScale;
+		UE_LOG(LogTemp, Log, TEXT("[Physics] Island mass %.1fkg, inertia (%.3g, %.3g, %.3g) kg*cm^2 about %s"),
+			Mass, Inertia.X, Inertia.Y, Inertia.Z, *Island.CenterOfMass.ToString());
+	}
+
 	// Step 5c: Enable custom physics simulation (not Chaos physics)
 	// Don't enable built-in physics - we'll handle it manually
 	RootComp.SetSimulatePhysics(false); // Disable built-in physics
@@ -1331,17 +2213,7 @@ void UVoxelIslandPhysics::UpdateFallingPhysics(float DeltaTime)
 	{
 		if (!IsValid(FallingVoxelWorlds[i]))
 		{
-			FallingVoxelWorlds.RemoveAt(i);
-			// Always remove from all arrays at the same index to maintain synchronization
-			if (i < FallingVelocities.Num()) FallingVelocities.RemoveAt(i);
-			if (i < bCustomPhysicsEnabled.Num()) bCustomPhysicsEnabled.RemoveAt(i);
-			if (i < bProxyDirty.Num()) bProxyDirty.RemoveAt(i);
-			if (i < LastEditTime.Num()) LastEditTime.RemoveAt(i);
-			if (i < bSettled.Num()) bSettled.RemoveAt(i);
-			if (i < SettleTimers.Num()) SettleTimers.RemoveAt(i);
-			// Also remove from any missing arrays if they were somehow longer
-			if (i < ProxyCookCounts.Num()) ProxyCookCounts.RemoveAt(i);
-			if (i < ProxyRebuildTimers.Num()) ProxyRebuildTimers.RemoveAt(i);
+			RemoveFallingWorldAt(i);
 		}
 	}
 	
@@ -1620,20 +2492,10 @@ void UVoxelIslandPhysics::CleanupOldestIsland()
 	{
 		UE_LOG(LogTemp, Warning, TEXT("VoxelIslandPhysics: Cleaning up oldest island %d to enforce performance caps"), OldestIndex);
 		
-		// Destroy the world
-		if (FallingVoxelWorlds[OldestIndex])
-		{
-			FallingVoxelWorlds[OldestIndex]->Destroy();
-		}
-		
-		// Remove from arrays
-		FallingVoxelWorlds.RemoveAt(OldestIndex);
-		if (bSettled.IsValidIndex(OldestIndex)) bSettled.RemoveAt(OldestIndex);
-		if (SettleTimers.IsValidIndex(OldestIndex)) SettleTimers.RemoveAt(OldestIndex);
-		if (bProxyDirty.IsValidIndex(OldestIndex)) bProxyDirty.RemoveAt(OldestIndex);
-		if (LastEditTime.IsValidIndex(OldestIndex)) LastEditTime.RemoveAt(OldestIndex);
-		if (ProxyCookCounts.IsValidIndex(OldestIndex)) ProxyCookCounts.RemoveAt(OldestIndex);
-		if (ProxyRebuildTimers.IsValidIndex(OldestIndex)) ProxyRebuildTimers.RemoveAt(OldestIndex);
+		// Back to the pool, or destroyed when the pool is full
+		AVoxelWorld* OldestWorld = FallingVoxelWorlds[OldestIndex];
+		RemoveFallingWorldAt(OldestIndex);
+		ReleaseFallingVoxelWorld(OldestWorld);
 	}
 }
 
@@ -1812,29 +2674,26 @@ int32 UVoxelIslandPhysics::CountSolidVoxels(AVoxelWorld* World, const FVoxelIsla
 	FIntVector Min = FIntVector(1, 1, 1); // Start after border
 	FIntVector Max = Min + IslandSize - FIntVector(1); // End before opposite border
 	
-	int32 SolidCount = 0;
-	FVoxelReadScopeLock ReadLock(World->GetData(), FVoxelIntBox(Min, Max + FIntVector(1)), "CountSolid");
+	FVoxelOccupancyBuffer Occupancy;
+	Occupancy.Read(World->GetData(), Min, Max);
 	
-	int32 TotalChecked = 0;
-	for (int32 X = Min.X; X <= Max.X; X++)
+	const int32 SolidCount = int32(Occupancy.CountSolid());
+	const int32 TotalChecked = IslandSize.X * IslandSize.Y * IslandSize.Z;
+	
+	// Log first few solid voxels found
+	int32 LoggedCount = 0;
+	for (int32 X = Min.X; X <= Max.X && LoggedCount < 3; X++)
 	{
-		for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+		for (int32 Y = Min.Y; Y <= Max.Y && LoggedCount < 3; Y++)
 		{
-			for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+			for (int32 Z = Min.Z; Z <= Max.Z && LoggedCount < 3; Z++)
 			{
 				FIntVector Pos(X, Y, Z);
-				FVoxelValue Value = World->GetData().GetValue(Pos, 0);
-				TotalChecked++;
-				
-				if (!Value.IsEmpty())
+				if (Occupancy.IsSolid(Pos))
 				{
-					SolidCount++;
-					// Log first few solid voxels found
-					if (SolidCount <= 3)
-					{
-						UE_LOG(LogTemp, Warning, TEXT("[Count] %s Pos(%d,%d,%d) SOLID #%d"), 
-							*WorldName, Pos.X, Pos.Y, Pos.Z, SolidCount);
-					}
+					LoggedCount++;
+					UE_LOG(LogTemp, Warning, TEXT("[Count] %s Pos(%d,%d,%d) SOLID #%d"), 
+						*WorldName, Pos.X, Pos.Y, Pos.Z, LoggedCount);
 				}
 			}
 		}
@@ -1853,30 +2712,35 @@ void UVoxelIslandPhysics::VerifyCarveOut(AVoxelWorld* World, const FVoxelIsland&
 		return;
 	}
 	
-	// Sample a few representative deleted voxel indices
-	TArray<FIntVector> SampleVoxels;
-	if (Island.VoxelPositions.Num() > 0)
+	if (Island.Voxels.Num() == 0)
 	{
-		SampleVoxels.Add(Island.MinBounds); // Min corner
-		SampleVoxels.Add(Island.MaxBounds); // Max corner
-		if (Island.VoxelPositions.Num() > 2)
-		{
-			SampleVoxels.Add(Island.VoxelPositions[Island.VoxelPositions.Num() / 2]); // Middle
-		}
+		return;
 	}
 	
-	for (const FIntVector& TestPos : SampleVoxels)
+	// One bulk read covers every deleted voxel, so check all of them instead of a few samples
+	FVoxelOccupancyBuffer Occupancy;
+	Occupancy.Read(World->GetData(), Island.MinBounds, Island.MaxBounds);
+	
+	int32 NotEmptyCount = 0;
+	for (const FIntVector TestPos : Island.Voxels)
 	{
-		FVoxelValue Value = World->GetData().GetValue(TestPos, 0);
-		bool bNowEmpty = Value.IsEmpty();
-		UE_LOG(LogTemp, Warning, TEXT("[CarveCheck] %s at %s"),
-			bNowEmpty ? TEXT("EMPTY") : TEXT("NOT EMPTY"), *TestPos.ToString());
-		
-		if (!bNowEmpty)
+		if (HasVoxelAt(Occupancy, TestPos))
 		{
-			UE_LOG(LogTemp, Error, TEXT("[CarveCheck] FAILED - Voxel still exists after carve!"));
+			NotEmptyCount++;
+			if (NotEmptyCount <= 3)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[CarveCheck] NOT EMPTY at %s"), *TestPos.ToString());
+			}
 		}
 	}
+	
+	UE_LOG(LogTemp, Warning, TEXT("[CarveCheck] %s: %d of %d carved voxels still solid"),
+		*WorldName, NotEmptyCount, Island.Voxels.Num());
+	
+	if (NotEmptyCount > 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[CarveCheck] FAILED - Voxel still exists after carve!"));
+	}
 }
 
 void UVoxelIslandPhysics::LogRenderStats(AVoxelWorld* World, const FString& WorldName)
@@ -1940,9 +2804,15 @@ void UVoxelIslandPhysics::LogRenderStats(AVoxelWorld* World, const FString& Worl
 // Step 2: Attach always-on invokers to both worlds
 void UVoxelIslandPhysics::AttachInvokers(AVoxelWorld* SourceWorld, AVoxelWorld* FallingWorld, const FVoxelIsland& Island)
 {
+	AVoxelWorld* SizingWorld = SourceWorld ? SourceWorld : FallingWorld;
+	if (!SizingWorld)
+	{
+		return;
+	}
+
 	// TOWER FIX: Calculate required render range to cover the island + proper padding for tall structures
 	FIntVector IslandSize = Island.MaxBounds - Island.MinBounds + FIntVector(1);
-	float MaxExtentCm = FMath::Max3(IslandSize.X, IslandSize.Y, IslandSize.Z) * SourceWorld->VoxelSize;
+	float MaxExtentCm = FMath::Max3(IslandSize.X, IslandSize.Y, IslandSize.Z) * SizingWorld->VoxelSize;
 	
 	// Dynamic padding: taller towers need proportionally more range
 	float DynamicPadding = FMath::Max(MaxExtentCm * 0.5f, 1000.0f); // At least 50% padding or 10m, whichever is larger
@@ -1953,34 +2823,41 @@ void UVoxelIslandPhysics::AttachInvokers(AVoxelWorld* SourceWorld, AVoxelWorld*
 		IslandSize.X, IslandSize.Y, IslandSize.Z, MaxExtentCm, DynamicPadding, RenderRange);
 	
 	// Attach invoker to SourceWorld
-	UVoxelSimpleInvokerComponent* SourceInvoker = NewObject<UVoxelSimpleInvokerComponent>(SourceWorld);
-	SourceInvoker->bUseForLOD = true;
-	SourceInvoker->LODRange = RenderRange;
-	SourceInvoker->bUseForCollisions = true;
-	SourceInvoker->CollisionsRange = CollisionRange;
-	SourceInvoker->bUseForNavmesh = false;
-	SourceWorld->AddInstanceComponent(SourceInvoker);
-	SourceInvoker->RegisterComponent();
-	SourceInvoker->EnableInvoker();
-	
-	UE_LOG(LogTemp, Warning, TEXT("[Invoker] Added invoker to SourceWorld @ Loc=(%.1f,%.1f,%.1f), RenderRange=%.1f, CollisionRange=%.1f"),
-		SourceWorld->GetActorLocation().X, SourceWorld->GetActorLocation().Y, SourceWorld->GetActorLocation().Z,
-		RenderRange, CollisionRange);
+	if (SourceWorld)
+	{
+		UVoxelSimpleInvokerComponent* SourceInvoker = NewObject<UVoxelSimpleInvokerComponent>(SourceWorld);
+		SourceInvoker->bUseForLOD = true;
+		SourceInvoker->LODRange = RenderRange;
+		SourceInvoker->bUseForCollisions = true;
+		SourceInvoker->CollisionsRange = CollisionRange;
+		SourceInvoker->bUseForNavmesh = false;
+		SourceWorld->AddInstanceComponent(SourceInvoker);
+		SourceInvoker->RegisterComponent();
+		SourceInvoker->EnableInvoker();
+		
+		UE_LOG(LogTemp, Warning, TEXT("[Invoker] Added invoker to SourceWorld @ Loc=(%.1f,%.1f,%.1f), RenderRange=%.1f, CollisionRange=%.1f"),
+			SourceWorld->GetActorLocation().X, SourceWorld->GetActorLocation().Y, SourceWorld->GetActorLocation().Z,
+			RenderRange, CollisionRange);
+	}
 	
 	// Attach invoker to FallingWorld
-	UVoxelSimpleInvokerComponent* FallingInvoker = NewObject<UVoxelSimpleInvokerComponent>(FallingWorld);
-	FallingInvoker->bUseForLOD = true;
-	FallingInvoker->LODRange = RenderRange;
-	FallingInvoker->bUseForCollisions = true;
-	FallingInvoker->CollisionsRange = CollisionRange;
-	FallingInvoker->bUseForNavmesh = false;
-	FallingWorld->AddInstanceComponent(FallingInvoker);
-	FallingInvoker->RegisterComponent();
-	FallingInvoker->EnableInvoker();
-	
-	UE_LOG(LogTemp, Warning, TEXT("[Invoker] Added invoker to FallingWorld @ Loc=(%.1f,%.1f,%.1f), RenderRange=%.1f, CollisionRange=%.1f"),
-		FallingWorld->GetActorLocation().X, FallingWorld->GetActorLocation().Y, FallingWorld->GetActorLocation().Z,
-		RenderRange, CollisionRange);
+	if (FallingWorld)
+	{
+		UVoxelSimpleInvokerComponent* FallingInvoker = NewObject<UVoxelSimpleInvokerComponent>(FallingWorld);
+		FallingInvoker->bUseForLOD = true;
+		FallingInvoker->LODRange = RenderRange;
+		FallingInvoker->bUseForCollisions = true;
+		FallingInvoker->CollisionsRange = CollisionRange;
+		FallingInvoker->bUseForNavmesh = false;
+		FallingInvoker->ComponentTags.Add(FName("IslandInvoker")); // Dropped when the world goes back to the pool
+		FallingWorld->AddInstanceComponent(FallingInvoker);
+		FallingInvoker->RegisterComponent();
+		FallingInvoker->EnableInvoker();
+		
+		UE_LOG(LogTemp, Warning, TEXT("[Invoker] Added invoker to FallingWorld @ Loc=(%.1f,%.1f,%.1f), RenderRange=%.1f, CollisionRange=%.1f"),
+			FallingWorld->GetActorLocation().X, FallingWorld->GetActorLocation().Y, FallingWorld->GetActorLocation().Z,
+			RenderRange, CollisionRange);
+	}
 }
 
 // Step 3: Rebuild synchronously after invokers are active
@@ -2224,10 +3101,13 @@ void UVoxelIslandPhysics::ContinueWithIslandCopy()
 	CopyVoxelDataRobust(PendingSourceWorld, PendingMeshWorld, PendingIsland, PendingWorldPosMin);
 	
 	// Remove the island voxels from source world (carve out)
-	RemoveIslandVoxels(PendingSourceWorld, PendingIsland);
+	FIntVector DirtyMin, DirtyMax;
+	if (RemoveIslandVoxels(PendingSourceWorld, PendingIsland, DirtyMin, DirtyMax))
+	{
+		RebuildWorldCollisionRegional(PendingSourceWorld, DirtyMin, DirtyMax, TEXT("SourceAfterCarve"));
+	}
 	
-	// Rebuild collision on both worlds
-	RebuildWorldCollision(PendingSourceWorld, TEXT("SourceAfterCarve"));
+	// Rebuild collision on the falling world
 	RebuildWorldCollision(PendingMeshWorld, TEXT("FallingAfterCopy"));
 	
 	// Verify visual state
@@ -2320,38 +3200,18 @@ void UVoxelIslandPhysics::ContinueWithIslandCopy()
 
 void UVoxelIslandPhysics::CopyVoxelDataRobust(AVoxelWorld* Source, AVoxelWorld* Destination, const FVoxelIsland& Island, const FVector& WorldPosMin)
 {
-	if (!Source || !Destination || Island.VoxelPositions.Num() == 0)
+	if (!Source || !Destination || Island.Voxels.Num() == 0)
 	{
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("[CopyRobust] Copying %d voxels with guaranteed solid density"), Island.VoxelPositions.Num());
+	UE_LOG(LogTemp, Warning, TEXT("[CopyRobust] Copying %d voxels with guaranteed solid density"), Island.Voxels.Num());
 	
-	// Get data locks
-	FVoxelReadScopeLock ReadLock(Source->GetData(), FVoxelIntBox::Infinite, "CopyRead");
-	FVoxelWriteScopeLock WriteLock(Destination->GetData(), FVoxelIntBox::Infinite, "CopyWrite");
-	
-	FIntVector MinIndex = Island.MinBounds;
-	
-	// Copy each voxel with border padding and explicit density/material
-	int32 CopiedCount = 0;
-	for (const FIntVector& SourcePos : Island.VoxelPositions)
-	{
-		// Read from source
-		FVoxelValue Value = Source->GetData().GetValue(SourcePos, 0);
-		FVoxelMaterial Material = Source->GetData().GetMaterial(SourcePos, 0);
-		
-		// Rebase to destination local coordinates (exact positioning)
-		FIntVector LocalPos = SourcePos - MinIndex;
-		
-		// CRITICAL: Always write solid density for triangle generation
-		FVoxelValue SolidValue(-1.0f); // NEGATIVE = SOLID (generates triangles)
-		
-		// Write to destination
-		Destination->GetData().SetValue(LocalPos, SolidValue);
-		Destination->GetData().SetMaterial(LocalPos, Material);
-		CopiedCount++;
-	}
+	// CRITICAL: Always write solid density for triangle generation, materials are kept
+	FVoxelIslandTransfer Transfer;
+	Transfer.Read(Source->GetData(), Island, FIntVector::ZeroValue);
+	Transfer.Write(Destination->GetData(), true);
+	const int32 CopiedCount = Transfer.GetNumVoxels();
 	
 	UE_LOG(LogTemp, Warning, TEXT("[CopyRobust] Successfully copied %d voxels as SOLID"), CopiedCount);
 }
@@ -2604,6 +3464,7 @@ void UVoxelIslandPhysics::CopyIslandDetectionSettings(AVoxelWorld* FallingWorld)
 	FallingPhysics->MaxTotalVoxels = this->MaxTotalVoxels;
 	FallingPhysics->MaxQuickScanVoxels = this->MaxQuickScanVoxels;
 	FallingPhysics->TowerHeightLimit = this->TowerHeightLimit;
+	FallingPhysics->bUseBrickLabeling = this->bUseBrickLabeling;
 	
 	UE_LOG(LogTemp, Warning, TEXT("[CopyIslandDetectionSettings] Copied settings: SearchPadding=%d, MaxFloodFill=%d, MaxTotalVoxels=%d, MaxQuickScan=%d"), 
 		FallingPhysics->SearchPadding, FallingPhysics->MaxFloodFillIterations, FallingPhysics->MaxTotalVoxels, FallingPhysics->MaxQuickScanVoxels);
@@ -7,20 +7,44 @@
 #include "VoxelData/VoxelData.h"
 #include "VoxelTools/Gen/VoxelBoxTools.h"
 #include "VoxelTools/Gen/VoxelSphereTools.h"
+#include "VoxelIslandDetection.h"
+#include "VoxelConnectivityGraph.h"
+#include "VoxelOccupancyPyramid.h"
+#include "VoxelIslandResultCache.h"
+#include "VoxelOccupancyBuffer.h"
+#include "VoxelIslandVoxels.h"
+#include "VoxelIsland.h"
 #include "VoxelIslandPhysics.generated.h"
 
-USTRUCT()
-struct FVoxelIsland
+// Fired on the game thread once detection for an edit has finished (sync or async)
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnVoxelIslandsDetected, AVoxelWorld*, const TArray<FVoxelIsland>&);
+
+// Islands one world returned from a batched detection, before they were processed
+struct FVoxelIslandBatchResult
 {
-	GENERATED_BODY()
+	TWeakObjectPtr<AVoxelWorld> World;
+	TArray<FVoxelIsland> Islands;
+};
 
-	TArray<FIntVector> VoxelPositions;
-	FIntVector MinBounds;
-	FIntVector MaxBounds;
-	FVector CenterOfMass;
-	bool bIsGrounded;
+// Fired on the game thread once every world of a batched detection has been processed
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnVoxelIslandBatchDetected, const TArray<FVoxelIslandBatchResult>&);
+
+// Blueprint-facing mirror of EVoxelConnectivity, which the engine-independent core cannot reflect
+UENUM(BlueprintType)
+enum class EVoxelIslandConnectivity : uint8
+{
+	// Shared faces only
+	Faces6 UMETA(DisplayName = "6 (Faces)"),
+	// Faces and edges
+	Edges18 UMETA(DisplayName = "18 (Faces + Edges)"),
+	// Faces, edges and corners
+	Corners26 UMETA(DisplayName = "26 (Faces + Edges + Corners)")
 };
 
+static_assert(uint8(EVoxelIslandConnectivity::Faces6) == uint8(EVoxelConnectivity::Faces6) &&
+	uint8(EVoxelIslandConnectivity::Edges18) == uint8(EVoxelConnectivity::Edges18) &&
+	uint8(EVoxelIslandConnectivity::Corners26) == uint8(EVoxelConnectivity::Corners26), "Connectivity enums must match");
+
 /**
  * Component that handles detection and physics simulation of disconnected voxel islands
  * This preserves the exact voxel data while enabling physics on disconnected chunks
@@ -48,10 +72,60 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Voxel Physics")
 	void CheckForDisconnectedIslandsFast(AVoxelWorld* World, FVector EditLocation, float EditRadius);
 
+	// Collect a dig for a coalesced island check. Digs whose padded boxes touch are merged into one region and
+	// checked once, after EditCoalesceWindow seconds or when FlushQueuedIslandChecks is called (end of a stroke).
+	UFUNCTION(BlueprintCallable, Category = "Voxel Physics")
+	void QueueIslandCheck(AVoxelWorld* World, FVector EditLocation, float EditRadius, bool bFast);
+
+	UFUNCTION(BlueprintCallable, Category = "Voxel Physics")
+	void FlushQueuedIslandChecks();
+
+	// Checks one explosion-style edit against every world it hit with a single async detection: the worlds
+	// are snapshotted and flooded in turn on one worker through shared scratch buffers. Each world's islands
+	// are processed by the component on that world (falling worlds) or by this one, all in the same
+	// game-thread completion, which then fires OnBatchIslandsDetected.
+	UFUNCTION(BlueprintCallable, Category = "Voxel Physics")
+	void CheckForDisconnectedIslandsInWorlds(const TArray<AVoxelWorld*>& Worlds, FVector EditLocation, float EditRadius);
+
+	// Seconds queued digs wait for more digs before their merged check runs (0 = check every dig immediately)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel Physics", meta = (ClampMin = "0.0", ClampMax = "2.0"))
+	float EditCoalesceWindow = 0.25f;
+
 	// Get falling voxel worlds for testing
 	UFUNCTION(BlueprintCallable, Category = "Voxel Physics")
 	const TArray<AVoxelWorld*>& GetFallingVoxelWorlds() const { return FallingVoxelWorlds; }
 
+	// Records a dig for the bridge analysis and returns false when the dig touches no weak link of the
+	// last analysis, so it cannot split a structure and its island check can be skipped. Always true
+	// while bPredictSeveringEdits is off or before the first analysis around the dig has finished.
+	UFUNCTION(BlueprintCallable, Category = "Voxel Physics")
+	bool ShouldCheckEditForIslands(AVoxelWorld* World, FVector EditLocation, float EditRadius);
+
+	// Tell the connectivity graph that voxels changed outside of a dig (builds, scripted edits)
+	UFUNCTION(BlueprintCallable, Category = "Voxel Physics")
+	void NotifyVoxelsEdited(AVoxelWorld* World, FVector BoundsMin, FVector BoundsMax);
+
+	// Bedrock heights in world units over CountX * CountY cells of CellSize starting at Origin (X fastest).
+	// Voxels at or below the height of their cell anchor pieces, e.g. fed from the generator's bedrock layer.
+	UFUNCTION(BlueprintCallable, Category = "Voxel Physics")
+	void SetAnchorHeightfield(FVector2D Origin, float CellSize, int32 CountX, int32 CountY, const TArray<float>& Heights);
+
+	// Rebuild ground anchors on the next check, e.g. after tagged anchor actors were spawned or moved
+	UFUNCTION(BlueprintCallable, Category = "Voxel Physics")
+	void InvalidateGroundAnchors();
+
+	// Number of async detections that have not delivered their result yet
+	int32 GetNumPendingAsyncDetections() const { return NumPendingAsyncDetections; }
+
+	// Number of time-sliced detections still being advanced on the game thread
+	int32 GetNumPendingDetectionJobs() const { return DetectionJobs.Num(); }
+
+	// Broadcast after detected islands have been processed
+	FOnVoxelIslandsDetected OnIslandsDetected;
+
+	// Broadcast by the component that started a batched detection, see CheckForDisconnectedIslandsInWorlds
+	FOnVoxelIslandBatchDetected OnBatchIslandsDetected;
+
 	// Configurable delay for mesh generation (in seconds)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel Physics", meta = (ClampMin = "0.0", ClampMax = "10.0"))
 	float MeshGenerationDelay = 0.0f;
@@ -72,18 +146,164 @@ public:
 	void ContinueWithIslandCopy();
 
 private:
-	// Island detection using flood fill algorithm
-	TArray<FVoxelIsland> DetectIslands(AVoxelWorld* World, const FIntVector& EditMin, const FIntVector& EditMax);
-	
-	// Check if a voxel position is connected to ground
-	bool IsConnectedToGround(AVoxelWorld* World, const FIntVector& StartPos, TSet<FIntVector>& Visited);
+	// Shared body of the island checks; bFast swaps in the reduced search limits for the duration of the call
+	void CheckForDisconnectedIslandsInShape(AVoxelWorld* World, const FVoxelIslandEditShape& EditShape, const FVector& EditLocation, bool bFast);
+
+	// Drops cached graph clusters, pyramid cells and bridge results around the carved spheres
+	void InvalidateEditedRegion(AVoxelWorld* World, const FVoxelIslandEditShape& EditShape);
+
+	// Edit box grown by TowerHeightLimit and HorizontalStructureLimit so whole structures fit the search
+	void GetExtendedEditBounds(AVoxelWorld* World, const FVoxelIslandEditShape& EditShape, FIntVector& OutMin, FIntVector& OutMax) const;
+
+	// Digs waiting for a coalesced check, kept as disjoint padded boxes per world
+	struct FQueuedIslandCheck
+	{
+		TWeakObjectPtr<AVoxelWorld> World;
+		FVoxelIslandEditShape Shape;
+		FIntVector Min;
+		FIntVector Max;
+		FVector EditLocation;
+		bool bFast = false;
+		int32 NumEdits = 0;
+	};
+	TArray<FQueuedIslandCheck> QueuedIslandChecks;
+	double FirstQueuedCheckTime = 0.0;
+
+	// Island detection using flood fill algorithm seeded from the carved shell
+	TArray<FVoxelIsland> DetectIslands(AVoxelWorld* World, const FIntVector& EditMin, const FIntVector& EditMax, const FVoxelIslandEditShape& Shape);
+
+	// Snapshot the search box and run detection on a worker thread, results come back on the game thread
+	void DetectIslandsAsync(AVoxelWorld* World, const FIntVector& EditMin, const FIntVector& EditMax, const FVoxelIslandEditShape& Shape, const FVector& EditLocation);
+	void StartAsyncDetection(AVoxelWorld* World, const FIntVector& SearchMin, const FIntVector& SearchMax, const FVoxelIslandEditShape& Shape, const FVector& EditLocation);
+	// Also receives the results of time-sliced jobs, which read the world over several frames
+	void OnAsyncDetectionComplete(AVoxelWorld* World, const TArray<FVoxelIsland>& Islands, const FVector& EditLocation);
+
+	// Check that an island found on a snapshot was not edited away before its result arrived
+	bool IsIslandStillPresent(AVoxelWorld* World, const FVoxelIsland& Island) const;
+
+	// Spawn falling worlds for ungrounded islands and notify listeners
+	void ProcessDetectedIslands(AVoxelWorld* World, const TArray<FVoxelIsland>& DetectedIslands, const FVector& EditLocation);
+
+	FVoxelIslandDetectionSettings MakeDetectionSettings(AVoxelWorld* World);
+
+	int32 NumPendingAsyncDetections = 0;
+
+	// Worker detections in flight. An edit overlapping the box one snapshots makes its result stale: it is
+	// thrown away when it arrives and the detection runs again, like the time-sliced jobs restart.
+	struct FPendingAsyncDetection
+	{
+		TWeakObjectPtr<AVoxelWorld> World;
+		FIntVector SearchMin = FIntVector::ZeroValue;
+		FIntVector SearchMax = FIntVector::ZeroValue;
+		FVoxelIslandEditShape Shape;
+		FVector EditLocation = FVector::ZeroVector;
+		bool bStale = false;
+	};
+	TMap<uint32, FPendingAsyncDetection> AsyncDetections;
+	uint32 NextAsyncDetectionId = 0;
+
+	uint32 AddAsyncDetection(AVoxelWorld* World, const FIntVector& SearchMin, const FIntVector& SearchMax, const FVoxelIslandEditShape& Shape, const FVector& EditLocation);
+	// False when the detection went stale and was started again instead
+	bool FinishAsyncDetection(uint32 DetectionId);
+
+	// Detection temporaries reused across digs on the game thread; jobs get their own since they keep
+	// progress in theirs between ticks. Jobs run one at a time, so they can share one.
+	FVoxelIslandScratch DetectionScratch;
+	FVoxelIslandScratch JobScratch;
+
+	// Time-sliced detections, advanced in order from TickComponent within DetectionBudgetMicroseconds
+	struct FPendingDetectionJob
+	{
+		TWeakObjectPtr<AVoxelWorld> World;
+		TUniquePtr<FVoxelIslandDetectionJob> Job;
+		FVector EditLocation;
+	};
+	TArray<FPendingDetectionJob> DetectionJobs;
+
+	void QueueDetectionJob(AVoxelWorld* World, const FIntVector& EditMin, const FIntVector& EditMax, const FVoxelIslandEditShape& Shape, const FVector& EditLocation);
+	void TickDetectionJobs();
+
+	// Jobs whose search box overlaps an edit start over so they never mix data from before and after it;
+	// async detections reading such a box are marked stale
+	void RestartOverlappingDetectionJobs(AVoxelWorld* World, const FIntVector& Min, const FIntVector& Max);
+
+	// Async detections whose search box overlaps the inclusive voxel box are detected again when they finish
+	void MarkAsyncDetectionsStale(AVoxelWorld* World, const FIntVector& Min, const FIntVector& Max);
+
+	// Cluster connectivity per voxel world, rebuilt locally as edits invalidate it
+	FVoxelConnectivityGraph& GetConnectivityGraph(AVoxelWorld* World);
+	TMap<TWeakObjectPtr<AVoxelWorld>, TUniquePtr<FVoxelConnectivityGraph>> ConnectivityGraphs;
+
+	// Empty/full summary per voxel world, filled in by game-thread reads and dropped by edits.
+	// Returns null when bUseOccupancyPyramid is off.
+	FVoxelOccupancyPyramid* GetOccupancyPyramid(AVoxelWorld* World);
+	void InvalidateOccupancyPyramid(AVoxelWorld* World, const FIntVector& VoxelMin, const FIntVector& VoxelMax);
+	TMap<TWeakObjectPtr<AVoxelWorld>, TUniquePtr<FVoxelOccupancyPyramid>> OccupancyPyramids;
+
+	// Chunk edit generations and recent results per voxel world. Returns null when bCacheDetectionResults is off.
+	FVoxelIslandResultCache* GetResultCache(AVoxelWorld* World);
+	void MarkResultCacheEdited(AVoxelWorld* World, const FIntVector& VoxelMin, const FIntVector& VoxelMax);
+	TMap<TWeakObjectPtr<AVoxelWorld>, TUniquePtr<FVoxelIslandResultCache>> ResultCaches;
+
+	// Everything besides the edit shape that changes what a check returns
+	uint32 GetDetectionSettingsHash(AVoxelWorld* World);
+
+	// Ground anchors per voxel world in its voxel space, built on first use and shared with async detections
+	TSharedPtr<const FVoxelGroundAnchorIndex> GetGroundAnchors(AVoxelWorld* World);
+	TMap<TWeakObjectPtr<AVoxelWorld>, TSharedPtr<const FVoxelGroundAnchorIndex>> GroundAnchors;
+
+	FVector2D AnchorHeightfieldOrigin = FVector2D::ZeroVector;
+	float AnchorHeightfieldCellSize = 0.0f;
+	int32 AnchorHeightfieldCountX = 0;
+	int32 AnchorHeightfieldCountY = 0;
+	TArray<float> AnchorHeightfield;
+
+	// Weak links found by the last bridge analysis of one world, see FVoxelBridgeRegions
+	struct FBridgeRegions : FVoxelBridgeRegions
+	{
+		double LastAnalysisTime = 0.0;
+		FIntVector LastEditVoxel = FIntVector::ZeroValue;
+	};
+	TMap<TWeakObjectPtr<AVoxelWorld>, FBridgeRegions> BridgeRegions;
+
+	void MarkBridgeRegionsDirty(AVoxelWorld* World, const FIntVector& VoxelMin, const FIntVector& VoxelMax);
+	void TickBridgeAnalysis();
 	
-	// Create a new falling voxel world for disconnected island
-	void CreateFallingVoxelWorld(AVoxelWorld* SourceWorld, const FVoxelIsland& Island, const FVector& EditLocation);
+	// Create falling voxel worlds for every island one cut broke off and carve them from the source together:
+	// the source is remeshed, given an invoker and rebuilt once over all the islands instead of once per island.
+	// Islands past MaxLiveIslands evict the oldest through CleanupOldestIsland; the largest islands go first.
+	void CreateFallingVoxelWorlds(AVoxelWorld* SourceWorld, const TArray<FVoxelIsland>& Islands, const FVector& EditLocation);
+
+	// Create, fill and start tracking the falling world of one island; leaves the source untouched
+	AVoxelWorld* CreateFallingVoxelWorld(AVoxelWorld* SourceWorld, const FVoxelIsland& Island, UMaterialInterface* VoxelMat);
 	
-	// Helper method that implements the proper world creation flow
+	// Helper method that implements the proper world creation flow: takes a pooled world of the smallest
+	// size class that fits, and only spawns one when the pool has none
 	AVoxelWorld* CreateFallingVoxelWorldInternal(const FIntVector& WorldSize, float InVoxelSize, const FTransform& DesiredTransform, UMaterialInterface* VoxelMat);
-	
+
+	// Spawn, configure and create a new empty falling world
+	AVoxelWorld* SpawnFallingVoxelWorld(const FIntVector& WorldSize, float InVoxelSize, const FTransform& DesiredTransform, UMaterialInterface* VoxelMat);
+
+	// Collision setup shared by freshly spawned and reused falling worlds
+	void ConfigureFallingWorldCollision(AVoxelWorld* W);
+
+	UMaterialInterface* LoadFallingWorldMaterial() const;
+
+	// Falling world pool, see bPoolFallingWorlds
+	void WarmFallingWorldPool();
+	// Smallest pool size class holding RequiredWorldSize voxels, INDEX_NONE when none does
+	int32 GetFallingWorldSizeClass(int32 RequiredWorldSize) const;
+	AVoxelWorld* AcquirePooledFallingWorld(int32 SizeClass, float InVoxelSize, const FTransform& DesiredTransform);
+	// Clear and park the world for the next island, or destroy it when pooling is off or its class is full
+	void ReleaseFallingVoxelWorld(AVoxelWorld* World);
+	void ParkFallingVoxelWorld(AVoxelWorld* World);
+
+	// Drop every cache, queued check and job this component keeps for a world
+	void ForgetVoxelWorld(AVoxelWorld* World);
+
+	// Remove a falling world from FallingVoxelWorlds and every array kept in step with it
+	void RemoveFallingWorldAt(int32 Index);
+
 	// Copy exact voxel data from source to destination with rebasing
 	void CopyVoxelData(AVoxelWorld* Source, AVoxelWorld* Destination, const FVoxelIsland& Island, const FVector& WorldPosMin);
 	
@@ -91,6 +311,8 @@ private:
 	void RebuildWorldCollision(AVoxelWorld* World, const FString& WorldName);
 	void RebuildWorldCollisionIncremental(AVoxelWorld* World, const FString& WorldName);
 	void RebuildWorldCollisionRegional(AVoxelWorld* World, const FVoxelIsland& Island, const FString& WorldName);
+	// Inclusive voxel bounds of the changed region
+	void RebuildWorldCollisionRegional(AVoxelWorld* World, const FIntVector& MinPos, const FIntVector& MaxPos, const FString& WorldName);
 	
 	// Enable physics on a falling voxel world with penetration guards
 	void EnablePhysicsWithGuards(AVoxelWorld* FallingWorld, const FVoxelIsland& Island);
@@ -98,11 +320,11 @@ private:
 	// Validate that collision geometry covers the full voxel shape
 	void ValidateVoxelCollision(AVoxelWorld* World, const FString& WorldName);
 	
-	// Check if voxel exists at position
-	bool HasVoxelAt(AVoxelWorld* World, const FIntVector& Position);
+	// Check if voxel exists at position in a bulk-read buffer
+	bool HasVoxelAt(const FVoxelOccupancyBuffer& Occupancy, const FIntVector& Position) const;
 	
-	// Remove voxels from source world
-	void RemoveIslandVoxels(AVoxelWorld* World, const FVoxelIsland& Island);
+	// Remove voxels from source world; OutDirtyMin/Max receive the inclusive region written
+	bool RemoveIslandVoxels(AVoxelWorld* World, const FVoxelIsland& Island, FIntVector& OutDirtyMin, FIntVector& OutDirtyMax);
 
 	// MultiIndex sanity write helper functions
 	void WriteSanityBlockMultiIndex(AVoxelWorld* World);
@@ -112,7 +334,11 @@ private:
 	// Track active falling voxel worlds
 	UPROPERTY()
 	TArray<AVoxelWorld*> FallingVoxelWorlds;
-	
+
+	// Empty falling worlds parked hidden between islands
+	UPROPERTY()
+	TArray<AVoxelWorld*> PooledFallingWorlds;
+
 	// Physics update for falling worlds
 	void UpdateFallingPhysics(float DeltaTime);
 	
@@ -207,6 +433,89 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Detection", meta = (ClampMin = "1000", ClampMax = "100000"))
 	int32 MaxIslandVoxels = 10000;
 
+	// Run island detection on a worker thread against a snapshot of the edited region instead of blocking the game thread
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Detection")
+	bool bAsyncIslandDetection = false;
+
+	// Spread game-thread detection over several frames instead of running it to completion (ignored when async)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Detection")
+	bool bTimeSlicedIslandDetection = false;
+
+	// Game-thread time per tick given to time-sliced detection jobs
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Detection", meta = (ClampMin = "100.0", ClampMax = "16000.0", EditCondition = "bTimeSlicedIslandDetection"))
+	float DetectionBudgetMicroseconds = 2000.0f;
+
+	// Label the whole search box with the 8x8x8 brick labeler instead of flood filling from the edit (exact, cost follows box size)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Detection")
+	bool bUseBrickLabeling = false;
+
+	// Answer severance checks from a persistent cluster connectivity graph instead of rescanning the extended edit area.
+	// The graph answers on the game thread, so the opt-in modes win over it. Precedence: bAsyncIslandDetection,
+	// then bTimeSlicedIslandDetection, then bUseBrickLabeling, then the graph (face-connected only), then the flood fill.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Detection")
+	bool bUseConnectivityGraph = true;
+
+	// Remember which 16^3 cells were empty or fully solid when last read, so game-thread detection and graph
+	// rebuilds skip reading them until an edit touches them. Async detections always read their snapshot.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Detection")
+	bool bUseOccupancyPyramid = true;
+
+	// Keep the last few check results per world and return them again when the same dig shape is checked
+	// over a region whose chunks have not changed since. Edits other than digs must be reported through
+	// NotifyVoxelsEdited, same as for the connectivity graph. Time-sliced and async results are not kept.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Detection")
+	bool bCacheDetectionResults = true;
+
+	// Whether pieces touching only along an edge or at a corner hold each other up. The connectivity graph
+	// and brick labeling are face-connected, so other modes always use the flood fill.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Detection")
+	EVoxelIslandConnectivity IslandConnectivity = EVoxelIslandConnectivity::Faces6;
+
+	// Async detections flood components of at least this many voxels level by level on the task graph
+	// (0 = never). Only used when MaxIslandVoxels is at least this large.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Detection", meta = (ClampMin = "0"))
+	int32 ParallelFloodMinVoxels = 100000;
+
+	// Analyze the clusters around recent digs in the background for weak links (articulation points and
+	// bridges of the cluster graph), and skip island checks for digs that touch none of them. This is a
+	// prediction at 16-voxel cluster granularity, see FVoxelConnectivityGraph::FindWeakClusters.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Detection")
+	bool bPredictSeveringEdits = false;
+
+	// Half size, in 16-voxel clusters, of the box analyzed around the latest dig
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Detection", meta = (ClampMin = "1", ClampMax = "16", EditCondition = "bPredictSeveringEdits"))
+	int32 BridgeAnalysisRadiusClusters = 6;
+
+	// Minimum seconds between two analyses of the same world
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Detection", meta = (ClampMin = "0.1", ClampMax = "60.0", EditCondition = "bPredictSeveringEdits"))
+	float BridgeAnalysisInterval = 2.0f;
+
+	// Voxels at or below this local voxel Z anchor pieces to the world
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ground Anchors")
+	int32 GroundAnchorLevel = 0;
+
+	// Actors with this tag (indestructible pillars, anchor volumes) anchor every voxel inside their bounds
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ground Anchors")
+	FName AnchorActorTag = TEXT("VoxelAnchor");
+
+	// Create empty falling worlds at BeginPlay and reuse them for islands instead of spawning and creating
+	// a voxel world at the moment a piece breaks off. Only components on non-falling worlds keep a pool.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Falling World Pool")
+	bool bPoolFallingWorlds = true;
+
+	// World sizes in voxels the pool keeps worlds of; islands needing more get a world of their own
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Falling World Pool", meta = (EditCondition = "bPoolFallingWorlds"))
+	TArray<int32> FallingWorldPoolSizeClasses = { 256, 512, 1024 };
+
+	// Worlds created per size class at BeginPlay, and most parked per class afterwards
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Falling World Pool", meta = (ClampMin = "0", ClampMax = "16", EditCondition = "bPoolFallingWorlds"))
+	int32 FallingWorldsPerSizeClass = 2;
+
+	// Let falling worlds read their island from a shared, read-only snapshot of the source chunks instead of
+	// having it written into their data; a falling world only stores the chunks that get edited afterwards
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Falling World Data")
+	bool bShareIslandSnapshots = true;
+
 	// Maximum build height in world units (prevents building above this Z coordinate)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Build Constraints", meta = (ClampMin = "1000.0", ClampMax = "20000.0"))
 	float MaxBuildHeight = 3200.0f;
@@ -237,7 +546,7 @@ private:
 	void VerifyCarveOut(AVoxelWorld* World, const FVoxelIsland& Island, const FString& WorldName);
 	void LogRenderStats(AVoxelWorld* World, const FString& WorldName);
 	
-	// Comprehensive invoker-based fix functions
+	// Comprehensive invoker-based fix functions; either world may be null to set up only the other one
 	void AttachInvokers(AVoxelWorld* SourceWorld, AVoxelWorld* FallingWorld, const FVoxelIsland& Island);
 	void SyncRebuildWorlds(AVoxelWorld* SourceWorld, AVoxelWorld* FallingWorld, const FVoxelIsland& Island);
 	void VerifyRuntimeStats(AVoxelWorld* SourceWorld, AVoxelWorld* FallingWorld, const FVoxelIsland& Island);
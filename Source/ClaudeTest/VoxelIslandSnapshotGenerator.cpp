@@ -0,0 +1,46 @@
+// VoxelIslandSnapshotGenerator.cpp
+#include "VoxelIslandSnapshotGenerator.h"
+
+TVoxelSharedRef<FVoxelGeneratorInstance> UVoxelIslandSnapshotGenerator::GetInstance()
+{
+	return MakeVoxelShared<FVoxelIslandSnapshotGeneratorInstance>(*this);
+}
+
+FVoxelIslandSnapshotGeneratorInstance::FVoxelIslandSnapshotGeneratorInstance(const UVoxelIslandSnapshotGenerator& Generator)
+	: Super(&Generator)
+	, Slot(Generator.GetSlot())
+{
+}
+
+v_flt FVoxelIslandSnapshotGeneratorInstance::GetValueImpl(v_flt X, v_flt Y, v_flt Z, int32 LOD, const FVoxelItemStack& Items) const
+{
+	const FIntVector Pos(FMath::FloorToInt(X), FMath::FloorToInt(Y), FMath::FloorToInt(Z));
+	return Slot->Sample<v_flt>(1, [&](const FVoxelIslandTransfer& Snapshot)
+	{
+		return v_flt(Snapshot.GetValue(Pos).ToFloat());
+	});
+}
+
+FVoxelMaterial FVoxelIslandSnapshotGeneratorInstance::GetMaterialImpl(v_flt X, v_flt Y, v_flt Z, int32 LOD, const FVoxelItemStack& Items) const
+{
+	const FIntVector Pos(FMath::FloorToInt(X), FMath::FloorToInt(Y), FMath::FloorToInt(Z));
+	return Slot->Sample<FVoxelMaterial>(FVoxelMaterial::Default(), [&](const FVoxelIslandTransfer& Snapshot)
+	{
+		return Snapshot.GetMaterial(Pos);
+	});
+}
+
+TVoxelRange<v_flt> FVoxelIslandSnapshotGeneratorInstance::GetValueRangeImpl(const FVoxelIntBox& Bounds, int32 LOD, const FVoxelItemStack& Items) const
+{
+	// Lets the plugin skip everything around the island as known empty
+	const bool bIntersects = Slot->Sample<bool>(false, [&](const FVoxelIslandTransfer& Snapshot)
+	{
+		return Snapshot.Intersects(Bounds.Min, Bounds.Max - FIntVector(1));
+	});
+	return bIntersects ? TVoxelRange<v_flt>(-1, 1) : TVoxelRange<v_flt>(1);
+}
+
+FVector FVoxelIslandSnapshotGeneratorInstance::GetUpVector(v_flt X, v_flt Y, v_flt Z) const
+{
+	return FVector::UpVector;
+}
@@ -0,0 +1,82 @@
+// VoxelIslandSnapshotGenerator.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelGenerators/VoxelGenerator.h"
+#include "VoxelGenerators/VoxelGeneratorHelpers.h"
+#include "VoxelIslandTransfer.h"
+#include "VoxelIslandSnapshotGenerator.generated.h"
+
+class UVoxelIslandSnapshotGenerator;
+
+// Snapshot a falling world currently shows. Shared between the generator object and its instances so a
+// pooled world can switch islands without recreating its generator; generator queries run on worker threads.
+class FVoxelIslandSnapshotSlot
+{
+public:
+	void Set(const TSharedPtr<const FVoxelIslandTransfer, ESPMode::ThreadSafe>& InSnapshot)
+	{
+		FWriteScopeLock Lock(SnapshotLock);
+		Snapshot = InSnapshot;
+	}
+
+	TSharedPtr<const FVoxelIslandTransfer, ESPMode::ThreadSafe> Get() const
+	{
+		FReadScopeLock Lock(SnapshotLock);
+		return Snapshot;
+	}
+
+	template<typename T, typename F>
+	T Sample(T Default, F Visit) const
+	{
+		FReadScopeLock Lock(SnapshotLock);
+		return Snapshot.IsValid() ? Visit(*Snapshot) : Default;
+	}
+
+private:
+	mutable FRWLock SnapshotLock;
+	TSharedPtr<const FVoxelIslandTransfer, ESPMode::ThreadSafe> Snapshot;
+};
+
+class FVoxelIslandSnapshotGeneratorInstance : public TVoxelGeneratorInstanceHelper<FVoxelIslandSnapshotGeneratorInstance, UVoxelIslandSnapshotGenerator>
+{
+public:
+	using Super = TVoxelGeneratorInstanceHelper<FVoxelIslandSnapshotGeneratorInstance, UVoxelIslandSnapshotGenerator>;
+
+	explicit FVoxelIslandSnapshotGeneratorInstance(const UVoxelIslandSnapshotGenerator& Generator);
+
+	//~ Begin FVoxelGeneratorInstance Interface
+	v_flt GetValueImpl(v_flt X, v_flt Y, v_flt Z, int32 LOD, const FVoxelItemStack& Items) const;
+	FVoxelMaterial GetMaterialImpl(v_flt X, v_flt Y, v_flt Z, int32 LOD, const FVoxelItemStack& Items) const;
+	TVoxelRange<v_flt> GetValueRangeImpl(const FVoxelIntBox& Bounds, int32 LOD, const FVoxelItemStack& Items) const;
+	virtual FVector GetUpVector(v_flt X, v_flt Y, v_flt Z) const override final;
+	//~ End FVoxelGeneratorInstance Interface
+
+private:
+	const TSharedRef<FVoxelIslandSnapshotSlot, ESPMode::ThreadSafe> Slot;
+};
+
+/**
+ * Generator of a falling world that serves the island it was split from straight out of the read-only,
+ * island-masked snapshot taken from the source world, so nothing is written into the falling world's data
+ * when it is created. The plugin only stores chunks that get edited, copying them from the generator
+ * first, so later digs into the falling island make the real copies. Empty when no snapshot is set.
+ */
+UCLASS()
+class CLAUDETEST_API UVoxelIslandSnapshotGenerator : public UVoxelGenerator
+{
+	GENERATED_BODY()
+
+public:
+	// The data bounds the snapshot covers must have their cache cleared and their render updated afterwards
+	void SetSnapshot(const TSharedPtr<const FVoxelIslandTransfer, ESPMode::ThreadSafe>& Snapshot) { Slot->Set(Snapshot); }
+
+	const TSharedRef<FVoxelIslandSnapshotSlot, ESPMode::ThreadSafe>& GetSlot() const { return Slot; }
+
+	//~ Begin UVoxelGenerator Interface
+	virtual TVoxelSharedRef<FVoxelGeneratorInstance> GetInstance() override;
+	//~ End UVoxelGenerator Interface
+
+private:
+	TSharedRef<FVoxelIslandSnapshotSlot, ESPMode::ThreadSafe> Slot = MakeShared<FVoxelIslandSnapshotSlot, ESPMode::ThreadSafe>();
+};
@@ -42,6 +42,7 @@ void UVoxelToolComponent::BeginPlay()
 	{
 		IslandPhysicsComponent = NewObject<UVoxelIslandPhysics>(Owner, TEXT("IslandPhysics"));
 		IslandPhysicsComponent->RegisterComponent();
+		IslandPhysicsComponent->bAsyncIslandDetection = bAsyncIslandDetectionOnDig;
 		UE_LOG(LogTemp, Log, TEXT("VoxelToolComponent: Island physics system initialized"));
 	}
 	
@@ -254,6 +255,14 @@ void UVoxelToolComponent::BuildAtLocation(FVector Location)
 	}
 }
 
+void UVoxelToolComponent::EndDigStroke()
+{
+	if (IslandPhysicsComponent)
+	{
+		IslandPhysicsComponent->FlushQueuedIslandChecks();
+	}
+}
+
 void UVoxelToolComponent::DigFromPlayerView()
 {
 	// Check cooldown
@@ -621,7 +630,8 @@ void UVoxelToolComponent::LocalBuildAtLocation(FVector Location, float Radius, f
 	float EffectiveRadius = Radius * FMath::Max(0.1f, Strength * 0.5f);
 	
 	// Check if smooth building is enabled and we have a previous build location
-	if (bEnableSmoothBuilding && bHasLastBuildLocation && bIsContinuousBuilding)
+	const bool bSmoothBuild = bEnableSmoothBuilding && bHasLastBuildLocation && bIsContinuousBuilding;
+	if (bSmoothBuild)
 	{
 		// Calculate distance to last build point
 		float DistanceToLast = FVector::Dist(Location, LastBuildLocation);
@@ -644,6 +654,15 @@ void UVoxelToolComponent::LocalBuildAtLocation(FVector Location, float Radius, f
 		bIsContinuousBuilding = true; // Start continuous building mode
 	}
 	
+	// Built voxels can reconnect islands - keep the physics connectivity graph in sync
+	if (IslandPhysicsComponent)
+	{
+		const FVector BuildStart = bSmoothBuild ? LastBuildLocation : Location;
+		IslandPhysicsComponent->NotifyVoxelsEdited(VoxelWorld,
+			BuildStart.ComponentMin(Location) - FVector(EffectiveRadius),
+			BuildStart.ComponentMax(Location) + FVector(EffectiveRadius));
+	}
+	
 	// Update last build location and time for next smooth build
 	LastBuildLocation = Location;
 	bHasLastBuildLocation = true;
@@ -699,10 +718,16 @@ void UVoxelToolComponent::LocalDigAtLocation(FVector Location, float Radius, flo
 	UE_LOG(LogTemp, Log, TEXT("Digging at location: %s with radius: %f, strength: %f, effective radius: %f"), 
 		*Location.ToString(), Radius, Strength, EffectiveRadius);
 
-	// Use the new island physics system to check for disconnected chunks
-	if (IslandPhysicsComponent && bEnableVoxelPhysics)
+	// Use the new island physics system to check for disconnected chunks. Digs away from every weak link
+	// the background bridge analysis found cannot break anything off and are not checked.
+	if (IslandPhysicsComponent && bEnableVoxelPhysics && IslandPhysicsComponent->ShouldCheckEditForIslands(VoxelWorld, Location, EffectiveRadius))
 	{
-		if (bUseFastPhysicsOnDig)
+		if (bCoalesceDigIslandChecks)
+		{
+			// Held digs land every frame - merge them and check once per stroke
+			IslandPhysicsComponent->QueueIslandCheck(VoxelWorld, Location, EffectiveRadius, bUseFastPhysicsOnDig);
+		}
+		else if (bUseFastPhysicsOnDig)
 		{
 			// Use fast detection to minimize lag while still enabling island creation
 			IslandPhysicsComponent->CheckForDisconnectedIslandsFast(VoxelWorld, Location, EffectiveRadius);
@@ -71,6 +71,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Voxel Tools")
 	void DigFromPlayerView();
 
+	// Dig button released - run the island check for the digs collected during the stroke
+	UFUNCTION(BlueprintCallable, Category = "Voxel Tools")
+	void EndDigStroke();
+
 	UFUNCTION(BlueprintCallable, Category = "Voxel Tools")
 	void BuildFromPlayerView();
 
@@ -138,6 +142,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel Physics", meta = (ToolTip = "Use fast physics mode during digging to prevent lag while still enabling island creation"))
 	bool bUseFastPhysicsOnDig = true;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel Physics", meta = (ToolTip = "Detect floating parts on a worker thread after digging (islands start falling a few frames later instead of hitching the game thread)"))
+	bool bAsyncIslandDetectionOnDig = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel Physics", meta = (ToolTip = "Collect digs made while the button is held and check the merged region once, instead of running island detection every frame"))
+	bool bCoalesceDigIslandChecks = true;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel Physics", meta = (ClampMin = "1", ClampMax = "10", ToolTip = "Minimum number of connected voxels before they fall with physics (1 = all disconnected parts fall, 10 = only small parts fall)"))
 	int32 MinPartsForPhysics = 1;
 
@@ -0,0 +1,254 @@
+// IslandCoreBench.cpp
+// Microbenchmarks of the island core on synthetic scenes. Prints milliseconds per iteration for each stage,
+// so a change to one detector can be compared against the others on the same data.
+// Usage: VoxelIslandCoreBench [--quick]   (--quick: smallest scenes, one iteration each)
+#include "CoreMinimal.h"
+#include "VoxelBrickLabeling.h"
+#include "VoxelConnectivityGraph.h"
+#include "VoxelIsland.h"
+#include "VoxelIslandDetection.h"
+#include "VoxelIslandTransfer.h"
+#include "VoxelIslandVoxels.h"
+#include "VoxelOccupancyBuffer.h"
+#include "VoxelOccupancyPyramid.h"
+#include "VoxelSyntheticGrids.h"
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+	struct FBenchConfig
+	{
+		int32 TerrainHalfExtent = 96;
+		int32 StructuresHalfExtent = 64;
+		int32 NumTowers = 24;
+		int32 TransferRadius = 24;
+		int32 Iterations = 10;
+	};
+
+	// Runs Body once to warm up, then Iterations times, and prints the average
+	template<typename TBody>
+	void Measure(const char* Name, int32 Iterations, TBody&& Body)
+	{
+		int64 Checksum = Body();
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			Checksum += Body();
+		}
+		const double Milliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Iterations;
+
+		std::printf("  %-40s %10.3f ms   (checksum %lld)\n", Name, Milliseconds, (long long)Checksum);
+	}
+
+	void BenchTerrain(const FBenchConfig& Config)
+	{
+		FVoxelSyntheticRandom Random(1);
+		FVoxelData Data;
+		FVoxelSyntheticGrids::AddRollingTerrain(Data, Random, Config.TerrainHalfExtent, 8, 32);
+
+		const FIntVector Min(-Config.TerrainHalfExtent, -Config.TerrainHalfExtent, -8);
+		const FIntVector Max(Config.TerrainHalfExtent, Config.TerrainHalfExtent, 63);
+		std::printf("Rolling terrain, %d chunks, box %s .. %s\n", Data.GetNumChunks(), *Min.ToString(), *Max.ToString());
+
+		FVoxelOccupancyBuffer Buffer;
+		Measure("OccupancyBuffer::Read", Config.Iterations, [&]()
+		{
+			Buffer.Read(Data, Min, Max);
+			return Buffer.CountSolid();
+		});
+
+		FVoxelIslandBitGrid Snapshot;
+		Measure("SnapshotOccupancy", Config.Iterations, [&]()
+		{
+			FVoxelIslandDetector::SnapshotOccupancy(Data, Min, Max, Snapshot);
+			return Snapshot.CountSet();
+		});
+
+		FVoxelBrickLabeling Labeling;
+		Measure("BrickLabeling::Label", Config.Iterations, [&]()
+		{
+			Labeling.Label(Snapshot);
+			return int64(Labeling.GetNumComponents());
+		});
+
+		// Every solid voxel of the terrain as one voxel set
+		TArray<FIntVector> Positions;
+		for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+		{
+			for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+			{
+				for (int32 X = Min.X; X <= Max.X; X++)
+				{
+					if (Snapshot.Get(FIntVector(X, Y, Z)))
+					{
+						Positions.Add(FIntVector(X, Y, Z));
+					}
+				}
+			}
+		}
+
+		FVoxelIslandVoxels Voxels;
+		Measure("FVoxelIslandVoxels::Assign", Config.Iterations, [&]()
+		{
+			Voxels.Assign(Positions);
+			return int64(Voxels.NumBricks());
+		});
+
+		Measure("FVoxelIslandVoxels::ComputeStats", Config.Iterations, [&]()
+		{
+			return int64(Voxels.ComputeStats().Centroid.Z * 1000.0);
+		});
+	}
+
+	void BenchStructures(const FBenchConfig& Config)
+	{
+		FVoxelSyntheticRandom Random(2);
+		FVoxelData Data;
+		const FVoxelIslandEditShape Shape = FVoxelSyntheticGrids::AddRandomStructures(Data, Random, Config.StructuresHalfExtent, Config.NumTowers);
+		FVoxelSyntheticGrids::Carve(Data, Shape);
+
+		const FIntVector SearchMin(-Config.StructuresHalfExtent - 1, -Config.StructuresHalfExtent - 1, -5);
+		const FIntVector SearchMax(Config.StructuresHalfExtent + 1, Config.StructuresHalfExtent + 1, 45);
+		std::printf("Towers on a slab, %d towers dug, %d chunks\n", Config.NumTowers, Data.GetNumChunks());
+
+		FVoxelIslandDetectionSettings Settings;
+		Settings.MaxFloodFillIterations = MAX_int32;
+		Settings.MaxIslandVoxels = MAX_int32;
+
+		FVoxelIslandScratch Scratch;
+		Measure("DetectIslands (flood race)", Config.Iterations, [&]()
+		{
+			return FVoxelSyntheticGrids::CountVoxels(FVoxelIslandDetector::DetectIslands(Data, SearchMin, SearchMax, Shape, Settings, &Scratch));
+		});
+
+		FVoxelIslandDetectionSettings LabelingSettings = Settings;
+		LabelingSettings.bUseBrickLabeling = true;
+		Measure("DetectIslands (brick labeling)", Config.Iterations, [&]()
+		{
+			return FVoxelSyntheticGrids::CountVoxels(FVoxelIslandDetector::DetectIslands(Data, SearchMin, SearchMax, Shape, LabelingSettings, &Scratch));
+		});
+
+		FVoxelIslandBitGrid Snapshot;
+		FVoxelIslandDetector::SnapshotOccupancy(Data, SearchMin, SearchMax, Snapshot);
+		Measure("DetectIslandsInSnapshot (serial)", Config.Iterations, [&]()
+		{
+			return FVoxelSyntheticGrids::CountVoxels(FVoxelIslandDetector::DetectIslandsInSnapshot(Snapshot, Shape, Settings, &Scratch));
+		});
+
+		FVoxelIslandDetectionSettings ParallelSettings = Settings;
+		ParallelSettings.ParallelFloodMinVoxels = 1;
+		Measure("DetectIslandsInSnapshot (parallel)", Config.Iterations, [&]()
+		{
+			return FVoxelSyntheticGrids::CountVoxels(FVoxelIslandDetector::DetectIslandsInSnapshot(Snapshot, Shape, ParallelSettings, &Scratch));
+		});
+
+		FVoxelOccupancyPyramid Pyramid;
+		FVoxelIslandDetector::DetectIslands(Data, SearchMin, SearchMax, Shape, Settings, &Scratch, &Pyramid);
+		Measure("DetectIslands (warm pyramid)", Config.Iterations, [&]()
+		{
+			return FVoxelSyntheticGrids::CountVoxels(FVoxelIslandDetector::DetectIslands(Data, SearchMin, SearchMax, Shape, Settings, &Scratch, &Pyramid));
+		});
+
+		FIntVector EditMin, EditMax;
+		Shape.GetBounds(1, EditMin, EditMax);
+		Measure("Graph FindSeveredIslands (cold)", Config.Iterations, [&]()
+		{
+			FVoxelConnectivityGraph Graph;
+			return FVoxelSyntheticGrids::CountVoxels(Graph.FindSeveredIslands(Data, EditMin, EditMax, Settings));
+		});
+
+		// What a dig pays once the graph is built: rebuild the clusters the edit touched, then search
+		FVoxelConnectivityGraph Graph;
+		Graph.FindSeveredIslands(Data, EditMin, EditMax, Settings);
+		Measure("Graph FindSeveredIslands (warm)", Config.Iterations, [&]()
+		{
+			int64 Count = 0;
+			for (const FVoxelIslandEditSphere& Sphere : Shape.Spheres)
+			{
+				const FIntVector Min = Sphere.Center - FIntVector(Sphere.Radius + 1);
+				const FIntVector Max = Sphere.Center + FIntVector(Sphere.Radius + 1);
+				Graph.Invalidate(Min, Max);
+				Count += FVoxelSyntheticGrids::CountVoxels(Graph.FindSeveredIslands(Data, Min, Max, Settings));
+			}
+			return Count;
+		});
+	}
+
+	void BenchTransfer(const FBenchConfig& Config)
+	{
+		// Floating ball whose chunks are shared with a slab it does not belong to
+		FVoxelData Source;
+		const FIntVector Center(5, -3, Config.TransferRadius + 2);
+		Source.SetSphere(Center, Config.TransferRadius, true);
+		Source.SetBox(FIntVector(-64, -64, -8), FIntVector(64, 64, 0), true);
+
+		TArray<FIntVector> Positions;
+		const FIntVector Extent(Config.TransferRadius);
+		for (int32 Z = Center.Z - Extent.Z; Z <= Center.Z + Extent.Z; Z++)
+		{
+			for (int32 Y = Center.Y - Extent.Y; Y <= Center.Y + Extent.Y; Y++)
+			{
+				for (int32 X = Center.X - Extent.X; X <= Center.X + Extent.X; X++)
+				{
+					if (Z > 0 && Source.IsSolid(FIntVector(X, Y, Z)))
+					{
+						Positions.Add(FIntVector(X, Y, Z));
+					}
+				}
+			}
+		}
+		FVoxelIsland Island;
+		Island.Voxels.Assign(Positions);
+		Island.UpdateStats();
+		std::printf("Island copy, %d voxels\n", Island.Voxels.Num());
+
+		// What CopyVoxelData used to do: one point read and one point write per voxel and field
+		Measure("Copy per voxel", Config.Iterations, [&]()
+		{
+			FVoxelData Destination;
+			for (const FIntVector Pos : Island.Voxels)
+			{
+				const FIntVector DestPos = Pos - Island.MinBounds;
+				Destination.SetValue(DestPos, Source.GetValue(Pos, 0));
+				Destination.SetMaterial(DestPos, Source.GetMaterial(Pos, 0));
+			}
+			return int64(Destination.GetNumChunks());
+		});
+
+		FVoxelIslandTransfer Transfer;
+		Measure("FVoxelIslandTransfer Read + Write", Config.Iterations, [&]()
+		{
+			FVoxelData Destination;
+			Transfer.Read(Source, Island, FIntVector::ZeroValue);
+			Transfer.Write(Destination);
+			return int64(Destination.GetNumChunks());
+		});
+
+		// Falling worlds sharing the snapshot skip the write altogether
+		Measure("FVoxelIslandTransfer Read (shared)", Config.Iterations, [&]()
+		{
+			Transfer.Read(Source, Island, FIntVector::ZeroValue);
+			return int64(Transfer.GetChunks().Num());
+		});
+	}
+}
+
+int main(int Argc, char** Argv)
+{
+	FBenchConfig Config;
+	if (Argc > 1 && std::strcmp(Argv[1], "--quick") == 0)
+	{
+		Config.TerrainHalfExtent = 24;
+		Config.StructuresHalfExtent = 24;
+		Config.NumTowers = 4;
+		Config.TransferRadius = 8;
+		Config.Iterations = 1;
+	}
+
+	BenchTerrain(Config);
+	BenchStructures(Config);
+	BenchTransfer(Config);
+	return 0;
+}
@@ -0,0 +1,226 @@
+// VoxelSyntheticGrids.h
+// Synthetic voxel scenes shared by the island core tests and benchmarks, plus a deliberately naive
+// reference search to check the optimized detectors against.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelData/VoxelData.h"
+#include "VoxelIslandDetection.h"
+#include "VoxelIsland.h"
+#include <deque>
+#include <set>
+#include <tuple>
+#include <vector>
+
+// Small deterministic generator, so every run builds the same scenes
+struct FVoxelSyntheticRandom
+{
+	uint64 State;
+
+	explicit FVoxelSyntheticRandom(uint64 Seed)
+		: State(Seed * 0x9E3779B97F4A7C15ull + 1)
+	{
+	}
+
+	uint64 Next()
+	{
+		// xorshift64*
+		State ^= State >> 12;
+		State ^= State << 25;
+		State ^= State >> 27;
+		return State * 0x2545F4914F6CDD1Dull;
+	}
+
+	// Inclusive range
+	int32 Range(int32 Min, int32 Max)
+	{
+		return Min + int32(Next() % uint64(Max - Min + 1));
+	}
+};
+
+struct FVoxelSyntheticGrids
+{
+	// Solid slab with its top at Z = 0, the default ground level
+	static void AddGround(FVoxelData& Data, int32 HalfExtent, int32 Depth)
+	{
+		Data.SetBox(FIntVector(-HalfExtent, -HalfExtent, 1 - Depth), FIntVector(HalfExtent, HalfExtent, 0), true);
+	}
+
+	// Square column standing on the ground, Size voxels wide with its corner at (X, Y)
+	static void AddTower(FVoxelData& Data, int32 X, int32 Y, int32 Size, int32 Height)
+	{
+		Data.SetBox(FIntVector(X, Y, 1), FIntVector(X + Size - 1, Y + Size - 1, Height), true);
+	}
+
+	static void Carve(FVoxelData& Data, const FVoxelIslandEditShape& Shape)
+	{
+		for (const FVoxelIslandEditSphere& Sphere : Shape.Spheres)
+		{
+			Data.SetSphere(Sphere.Center, Sphere.Radius, false);
+		}
+	}
+
+	// Ground with towers, some joined by beams. Returns one dig per tower at a random height, so some
+	// digs sever their tower and some only nick it.
+	static FVoxelIslandEditShape AddRandomStructures(FVoxelData& Data, FVoxelSyntheticRandom& Random, int32 HalfExtent, int32 NumTowers)
+	{
+		AddGround(Data, HalfExtent, 4);
+
+		FVoxelIslandEditShape Shape;
+		FIntVector LastTop = FIntVector::NoneValue;
+		for (int32 Tower = 0; Tower < NumTowers; Tower++)
+		{
+			const int32 Size = Random.Range(2, 6);
+			const int32 Height = Random.Range(12, 40);
+			const int32 X = Random.Range(-HalfExtent + 8, HalfExtent - 8 - Size);
+			const int32 Y = Random.Range(-HalfExtent + 8, HalfExtent - 8 - Size);
+			AddTower(Data, X, Y, Size, Height);
+
+			const FIntVector Top(X, Y, Height);
+			if (LastTop != FIntVector::NoneValue && Random.Range(0, 2) == 0)
+			{
+				// Beam along X then Y at the lower of the two tops
+				const int32 Z = FMath::Min(LastTop.Z, Top.Z);
+				Data.SetBox(FIntVector(FMath::Min(LastTop.X, Top.X), LastTop.Y, Z - 1), FIntVector(FMath::Max(LastTop.X, Top.X), LastTop.Y + 1, Z), true);
+				Data.SetBox(FIntVector(Top.X, FMath::Min(LastTop.Y, Top.Y), Z - 1), FIntVector(Top.X + 1, FMath::Max(LastTop.Y, Top.Y), Z), true);
+			}
+			LastTop = Top;
+
+			Shape.AddSphere(FIntVector(X + Size / 2, Y + Size / 2, Random.Range(3, Height - 2)), Random.Range(2, 5));
+		}
+		return Shape;
+	}
+
+	// Rolling heightfield terrain between Z = -Depth and about MaxHeight, with overhanging arches and
+	// floating rocks, as a stand-in for an edited landscape
+	static void AddRollingTerrain(FVoxelData& Data, FVoxelSyntheticRandom& Random, int32 HalfExtent, int32 Depth, int32 MaxHeight)
+	{
+		for (int32 Y = -HalfExtent; Y <= HalfExtent; Y++)
+		{
+			for (int32 X = -HalfExtent; X <= HalfExtent; X++)
+			{
+				const double Wave = std::sin(X * 0.07) * std::cos(Y * 0.05) + 0.5 * std::sin((X + Y) * 0.13);
+				const int32 Height = int32((Wave + 1.5) / 3.0 * MaxHeight);
+				for (int32 Z = -Depth; Z <= Height; Z++)
+				{
+					Data.SetSolid(FIntVector(X, Y, Z), true);
+				}
+			}
+		}
+
+		const int32 NumRocks = FMath::Max(1, HalfExtent / 4);
+		for (int32 Rock = 0; Rock < NumRocks; Rock++)
+		{
+			const FIntVector Center(Random.Range(-HalfExtent + 8, HalfExtent - 8), Random.Range(-HalfExtent + 8, HalfExtent - 8), MaxHeight + Random.Range(8, 24));
+			Data.SetSphere(Center, Random.Range(2, 6), true);
+		}
+	}
+
+	static int64 CountVoxels(const TArray<FVoxelIsland>& Islands)
+	{
+		int64 Count = 0;
+		for (const FVoxelIsland& Island : Islands)
+		{
+			Count += Island.Voxels.Num();
+		}
+		return Count;
+	}
+
+	// Sorted voxel lists of every island, so results of different detectors compare regardless of order
+	static std::vector<std::vector<std::tuple<int32, int32, int32>>> Canonicalize(const TArray<FVoxelIsland>& Islands)
+	{
+		std::vector<std::vector<std::tuple<int32, int32, int32>>> Result;
+		for (const FVoxelIsland& Island : Islands)
+		{
+			std::vector<std::tuple<int32, int32, int32>>& Voxels = Result.emplace_back();
+			for (const FIntVector Pos : Island.Voxels)
+			{
+				Voxels.emplace_back(Pos.X, Pos.Y, Pos.Z);
+			}
+			std::sort(Voxels.begin(), Voxels.end());
+		}
+		std::sort(Result.begin(), Result.end());
+		return Result;
+	}
+
+	// Reference answer: breadth-first search with std containers over every solid voxel of the inclusive
+	// box. Keeps components of at least 5 voxels that touch the carved shell, never reach an anchor and
+	// never touch the box edge - the same rules the detectors apply.
+	static std::vector<std::vector<std::tuple<int32, int32, int32>>> FindFloatingReference(
+		const FVoxelData& Data,
+		const FIntVector& Min,
+		const FIntVector& Max,
+		const FVoxelIslandEditShape& Shape,
+		const FVoxelIslandDetectionSettings& Settings)
+	{
+		const int32 MaxOffsetSum = Settings.Connectivity == EVoxelConnectivity::Faces6 ? 1 : (Settings.Connectivity == EVoxelConnectivity::Edges18 ? 2 : 3);
+		auto ForEachNeighbor = [&](const FIntVector& Pos, auto&& Visit)
+		{
+			for (int32 Z = -1; Z <= 1; Z++)
+			{
+				for (int32 Y = -1; Y <= 1; Y++)
+				{
+					for (int32 X = -1; X <= 1; X++)
+					{
+						const int32 OffsetSum = FMath::Abs(X) + FMath::Abs(Y) + FMath::Abs(Z);
+						if (OffsetSum > 0 && OffsetSum <= MaxOffsetSum)
+						{
+							Visit(Pos + FIntVector(X, Y, Z));
+						}
+					}
+				}
+			}
+		};
+
+		auto Inside = [&](const FIntVector& Pos)
+		{
+			return Pos.X >= Min.X && Pos.X <= Max.X && Pos.Y >= Min.Y && Pos.Y <= Max.Y && Pos.Z >= Min.Z && Pos.Z <= Max.Z;
+		};
+
+		std::set<std::tuple<int32, int32, int32>> Visited;
+		std::vector<std::vector<std::tuple<int32, int32, int32>>> Result;
+		for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+		{
+			for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+			{
+				for (int32 X = Min.X; X <= Max.X; X++)
+				{
+					const FIntVector Start(X, Y, Z);
+					if (!Data.IsSolid(Start) || !Visited.insert({ X, Y, Z }).second)
+					{
+						continue;
+					}
+
+					std::vector<std::tuple<int32, int32, int32>> Component;
+					std::deque<FIntVector> Queue{ Start };
+					bool bGrounded = false;
+					bool bTouchesShell = false;
+					while (!Queue.empty())
+					{
+						const FIntVector Pos = Queue.front();
+						Queue.pop_front();
+						Component.emplace_back(Pos.X, Pos.Y, Pos.Z);
+
+						bGrounded |= Settings.IsAnchor(Pos) || Pos.X == Min.X || Pos.X == Max.X || Pos.Y == Min.Y || Pos.Y == Max.Y || Pos.Z == Min.Z || Pos.Z == Max.Z;
+						ForEachNeighbor(Pos, [&](const FIntVector& Neighbor)
+						{
+							bTouchesShell |= Shape.IsCarved(Neighbor);
+							if (Inside(Neighbor) && Data.IsSolid(Neighbor) && Visited.insert({ Neighbor.X, Neighbor.Y, Neighbor.Z }).second)
+							{
+								Queue.push_back(Neighbor);
+							}
+						});
+					}
+
+					if (!bGrounded && bTouchesShell && Component.size() >= 5 && int64(Component.size()) <= Settings.MaxIslandVoxels)
+					{
+						std::sort(Component.begin(), Component.end());
+						Result.push_back(MoveTemp(Component));
+					}
+				}
+			}
+		}
+		std::sort(Result.begin(), Result.end());
+		return Result;
+	}
+};
@@ -0,0 +1,49 @@
+// ParallelFor.h
+// Standalone stand-in for the engine's ParallelFor: indices are handed out to one std::thread per core
+#pragma once
+
+#include "CoreMinimal.h"
+#include <thread>
+#include <vector>
+
+enum class EParallelForFlags
+{
+	None = 0,
+	ForceSingleThread = 1 << 0
+};
+
+template<typename FunctionType>
+void ParallelFor(int32 Num, FunctionType&& Body, EParallelForFlags Flags = EParallelForFlags::None)
+{
+	const int32 NumThreads = FMath::Min(Num, int32(std::thread::hardware_concurrency()));
+	if (Flags == EParallelForFlags::ForceSingleThread || NumThreads <= 1)
+	{
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			Body(Index);
+		}
+		return;
+	}
+
+	std::atomic<int32> NextIndex(0);
+	auto Worker = [&]()
+	{
+		for (int32 Index = NextIndex++; Index < Num; Index = NextIndex++)
+		{
+			Body(Index);
+		}
+	};
+
+	// The calling thread works too, like the engine's task graph
+	std::vector<std::thread> Threads;
+	Threads.reserve(NumThreads - 1);
+	for (int32 Thread = 1; Thread < NumThreads; Thread++)
+	{
+		Threads.emplace_back(Worker);
+	}
+	Worker();
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+}
@@ -0,0 +1,1146 @@
+// CoreMinimal.h
+// Standalone stand-in for the handful of Unreal Core types the island core uses, so the files under
+// Source/ClaudeTest/IslandCore compile unchanged without the engine. Only the subset the core needs is
+// provided, with the same semantics (min-heaps by predicate, Reset keeping memory, ...).
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+typedef signed char int8;
+typedef unsigned char uint8;
+typedef signed short int16;
+typedef unsigned short uint16;
+typedef signed int int32;
+typedef unsigned int uint32;
+typedef signed long long int64;
+typedef unsigned long long uint64;
+typedef char TCHAR;
+
+#define TEXT(x) x
+#define FORCEINLINE inline
+#define INDEX_NONE (-1)
+#define MAX_int32 (0x7fffffff)
+#define MIN_int32 (-0x7fffffff - 1)
+#define check(Expr) assert(Expr)
+#define checkf(Expr, ...) assert(Expr)
+
+#define ENUM_CLASS_FLAGS(Enum) \
+	inline constexpr Enum operator|(Enum A, Enum B) { return Enum(std::underlying_type_t<Enum>(A) | std::underlying_type_t<Enum>(B)); } \
+	inline constexpr Enum operator&(Enum A, Enum B) { return Enum(std::underlying_type_t<Enum>(A) & std::underlying_type_t<Enum>(B)); } \
+	inline Enum& operator|=(Enum& A, Enum B) { return A = A | B; } \
+	inline Enum& operator&=(Enum& A, Enum B) { return A = A & B; }
+
+template<typename TEnum>
+constexpr bool EnumHasAnyFlags(TEnum Flags, TEnum Contains)
+{
+	return (std::underlying_type_t<TEnum>(Flags) & std::underlying_type_t<TEnum>(Contains)) != 0;
+}
+
+enum class EAllowShrinking : uint8
+{
+	No,
+	Yes
+};
+
+template<typename T>
+FORCEINLINE std::remove_reference_t<T>&& MoveTemp(T&& Value)
+{
+	return static_cast<std::remove_reference_t<T>&&>(Value);
+}
+
+template<typename T>
+FORCEINLINE T&& Forward(std::remove_reference_t<T>& Value)
+{
+	return static_cast<T&&>(Value);
+}
+
+template<typename T>
+FORCEINLINE void Swap(T& A, T& B)
+{
+	T Temp = MoveTemp(A);
+	A = MoveTemp(B);
+	B = MoveTemp(Temp);
+}
+
+template<typename T, T InValue>
+struct TIntegralConstant
+{
+	static constexpr T Value = InValue;
+};
+
+template<typename T, T... Indices>
+using TIntegerSequence = std::integer_sequence<T, Indices...>;
+
+template<typename T, T Count>
+using TMakeIntegerSequence = std::make_integer_sequence<T, Count>;
+
+/* Logging
+ *****************************************************************************/
+
+namespace ELogVerbosity
+{
+	enum Type : uint8
+	{
+		Fatal,
+		Error,
+		Warning,
+		Display,
+		Log,
+		Verbose,
+		VeryVerbose
+	};
+}
+
+// Messages are dropped unless ISLANDCORE_LOG is set, so tests and benchmarks stay quiet
+struct FIslandCoreLog
+{
+	static bool IsEnabled()
+	{
+		static const bool bEnabled = std::getenv("ISLANDCORE_LOG") != nullptr;
+		return bEnabled;
+	}
+
+	static void Log(ELogVerbosity::Type Verbosity, const TCHAR* Format, ...)
+	{
+		if (!IsEnabled())
+		{
+			return;
+		}
+
+		va_list Args;
+		va_start(Args, Format);
+		std::fputs(Verbosity <= ELogVerbosity::Warning ? "Warning: " : "Log: ", stderr);
+		std::vfprintf(stderr, Format, Args);
+		std::fputc('\n', stderr);
+		va_end(Args);
+	}
+};
+
+#define UE_LOG(Category, Verbosity, Format, ...) FIslandCoreLog::Log(ELogVerbosity::Verbosity, Format, ##__VA_ARGS__)
+
+/* Platform
+ *****************************************************************************/
+
+struct FMemory
+{
+	static FORCEINLINE void* Memcpy(void* Dest, const void* Src, size_t Count) { return std::memcpy(Dest, Src, Count); }
+	static FORCEINLINE void* Memset(void* Dest, uint8 Value, size_t Count) { return std::memset(Dest, Value, Count); }
+	static FORCEINLINE void* Memzero(void* Dest, size_t Count) { return std::memset(Dest, 0, Count); }
+};
+
+struct FPlatformTime
+{
+	static double Seconds()
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+};
+
+struct FPlatformAtomics
+{
+	static FORCEINLINE int64 InterlockedOr(volatile int64* Dest, int64 Value)
+	{
+		return __atomic_fetch_or(const_cast<int64*>(Dest), Value, __ATOMIC_SEQ_CST);
+	}
+};
+
+struct FMath
+{
+	template<typename T> static constexpr FORCEINLINE T Min(T A, T B) { return A < B ? A : B; }
+	template<typename T> static constexpr FORCEINLINE T Max(T A, T B) { return A > B ? A : B; }
+	template<typename T> static constexpr FORCEINLINE T Abs(T A) { return A < 0 ? -A : A; }
+	template<typename T> static constexpr FORCEINLINE T Square(T A) { return A * A; }
+	template<typename T> static constexpr FORCEINLINE T Clamp(T X, T Lo, T Hi) { return X < Lo ? Lo : (X > Hi ? Hi : X); }
+	template<typename T> static constexpr FORCEINLINE T DivideAndRoundUp(T Dividend, T Divisor) { return (Dividend + Divisor - 1) / Divisor; }
+	template<typename T> static constexpr FORCEINLINE T DivideAndRoundDown(T Dividend, T Divisor) { return Dividend / Divisor; }
+
+	static FORCEINLINE int32 CeilToInt(double Value) { return int32(std::ceil(Value)); }
+	static FORCEINLINE int32 FloorToInt(double Value) { return int32(std::floor(Value)); }
+	static FORCEINLINE double Sqrt(double Value) { return std::sqrt(Value); }
+
+	static FORCEINLINE int32 CountBits(uint64 Bits) { return __builtin_popcountll(Bits); }
+	static FORCEINLINE uint32 CountTrailingZeros(uint32 Value) { return Value ? __builtin_ctz(Value) : 32; }
+	static FORCEINLINE uint64 CountTrailingZeros64(uint64 Value) { return Value ? __builtin_ctzll(Value) : 64; }
+	static FORCEINLINE uint32 CountLeadingZeros(uint32 Value) { return Value ? __builtin_clz(Value) : 32; }
+	static FORCEINLINE uint64 CountLeadingZeros64(uint64 Value) { return Value ? __builtin_clzll(Value) : 64; }
+};
+
+/* Hashing
+ *****************************************************************************/
+
+// Bob Jenkins' mix, as used by the engine
+FORCEINLINE uint32 HashCombine(uint32 A, uint32 C)
+{
+	uint32 B = 0x9e3779b9;
+	A += B;
+
+	A -= B; A -= C; A ^= (C >> 13);
+	B -= C; B -= A; B ^= (A << 8);
+	C -= A; C -= B; C ^= (B >> 13);
+	A -= B; A -= C; A ^= (C >> 12);
+	B -= C; B -= A; B ^= (A << 16);
+	C -= A; C -= B; C ^= (B >> 5);
+	A -= B; A -= C; A ^= (C >> 3);
+	B -= C; B -= A; B ^= (A << 10);
+	C -= A; C -= B; C ^= (B >> 15);
+
+	return C;
+}
+
+FORCEINLINE uint32 GetTypeHash(bool Value) { return uint32(Value); }
+FORCEINLINE uint32 GetTypeHash(uint8 Value) { return Value; }
+FORCEINLINE uint32 GetTypeHash(int32 Value) { return uint32(Value); }
+FORCEINLINE uint32 GetTypeHash(uint32 Value) { return Value; }
+FORCEINLINE uint32 GetTypeHash(int64 Value) { return uint32(Value) + (uint32(Value >> 32) * 23); }
+FORCEINLINE uint32 GetTypeHash(uint64 Value) { return uint32(Value) + (uint32(Value >> 32) * 23); }
+FORCEINLINE uint32 GetTypeHash(const void* Value) { return GetTypeHash(uint64(reinterpret_cast<uintptr_t>(Value)) >> 4); }
+
+/* Strings and math types
+ *****************************************************************************/
+
+class FString
+{
+public:
+	FString() = default;
+	FString(const TCHAR* Text) : Data(Text) {}
+
+	const TCHAR* operator*() const { return Data.c_str(); }
+	int32 Len() const { return int32(Data.size()); }
+
+	static FString Printf(const TCHAR* Format, ...)
+	{
+		TCHAR Buffer[512];
+		va_list Args;
+		va_start(Args, Format);
+		std::vsnprintf(Buffer, sizeof(Buffer), Format, Args);
+		va_end(Args);
+		return FString(Buffer);
+	}
+
+private:
+	std::string Data;
+};
+
+struct FIntVector
+{
+	int32 X = 0;
+	int32 Y = 0;
+	int32 Z = 0;
+
+	static const FIntVector ZeroValue;
+	static const FIntVector NoneValue;
+
+	constexpr FIntVector() = default;
+	constexpr explicit FIntVector(int32 Value) : X(Value), Y(Value), Z(Value) {}
+	constexpr FIntVector(int32 InX, int32 InY, int32 InZ) : X(InX), Y(InY), Z(InZ) {}
+
+	constexpr FIntVector operator+(const FIntVector& Other) const { return FIntVector(X + Other.X, Y + Other.Y, Z + Other.Z); }
+	constexpr FIntVector operator-(const FIntVector& Other) const { return FIntVector(X - Other.X, Y - Other.Y, Z - Other.Z); }
+	constexpr FIntVector operator*(int32 Scale) const { return FIntVector(X * Scale, Y * Scale, Z * Scale); }
+	constexpr FIntVector operator/(int32 Divisor) const { return FIntVector(X / Divisor, Y / Divisor, Z / Divisor); }
+	constexpr FIntVector operator>>(int32 Shift) const { return FIntVector(X >> Shift, Y >> Shift, Z >> Shift); }
+	constexpr FIntVector operator<<(int32 Shift) const { return FIntVector(X << Shift, Y << Shift, Z << Shift); }
+	FIntVector& operator+=(const FIntVector& Other) { X += Other.X; Y += Other.Y; Z += Other.Z; return *this; }
+	FIntVector& operator-=(const FIntVector& Other) { X -= Other.X; Y -= Other.Y; Z -= Other.Z; return *this; }
+
+	constexpr bool operator==(const FIntVector& Other) const { return X == Other.X && Y == Other.Y && Z == Other.Z; }
+	constexpr bool operator!=(const FIntVector& Other) const { return !(*this == Other); }
+
+	int32& operator[](int32 Index) { return (&X)[Index]; }
+	int32 operator[](int32 Index) const { return (&X)[Index]; }
+
+	constexpr int32 GetMax() const { return FMath::Max(X, FMath::Max(Y, Z)); }
+	constexpr int32 GetMin() const { return FMath::Min(X, FMath::Min(Y, Z)); }
+
+	FString ToString() const { return FString::Printf(TEXT("X=%d Y=%d Z=%d"), X, Y, Z); }
+};
+
+inline constexpr FIntVector FIntVector::ZeroValue(0, 0, 0);
+inline constexpr FIntVector FIntVector::NoneValue(INDEX_NONE, INDEX_NONE, INDEX_NONE);
+
+FORCEINLINE uint32 GetTypeHash(const FIntVector& Vector)
+{
+	return HashCombine(HashCombine(GetTypeHash(Vector.X), GetTypeHash(Vector.Y)), GetTypeHash(Vector.Z));
+}
+
+struct FVector
+{
+	double X = 0.0;
+	double Y = 0.0;
+	double Z = 0.0;
+
+	static const FVector ZeroVector;
+	static const FVector OneVector;
+
+	constexpr FVector() = default;
+	constexpr explicit FVector(double Value) : X(Value), Y(Value), Z(Value) {}
+	constexpr FVector(double InX, double InY, double InZ) : X(InX), Y(InY), Z(InZ) {}
+	constexpr explicit FVector(const FIntVector& Vector) : X(Vector.X), Y(Vector.Y), Z(Vector.Z) {}
+
+	constexpr FVector operator+(const FVector& Other) const { return FVector(X + Other.X, Y + Other.Y, Z + Other.Z); }
+	constexpr FVector operator-(const FVector& Other) const { return FVector(X - Other.X, Y - Other.Y, Z - Other.Z); }
+	constexpr FVector operator*(const FVector& Other) const { return FVector(X * Other.X, Y * Other.Y, Z * Other.Z); }
+	constexpr FVector operator*(double Scale) const { return FVector(X * Scale, Y * Scale, Z * Scale); }
+	constexpr FVector operator/(double Divisor) const { return FVector(X / Divisor, Y / Divisor, Z / Divisor); }
+	constexpr FVector operator-() const { return FVector(-X, -Y, -Z); }
+	FVector& operator+=(const FVector& Other) { X += Other.X; Y += Other.Y; Z += Other.Z; return *this; }
+	FVector& operator-=(const FVector& Other) { X -= Other.X; Y -= Other.Y; Z -= Other.Z; return *this; }
+	FVector& operator*=(double Scale) { X *= Scale; Y *= Scale; Z *= Scale; return *this; }
+	FVector& operator/=(double Divisor) { X /= Divisor; Y /= Divisor; Z /= Divisor; return *this; }
+
+	constexpr bool operator==(const FVector& Other) const { return X == Other.X && Y == Other.Y && Z == Other.Z; }
+	constexpr bool operator!=(const FVector& Other) const { return !(*this == Other); }
+
+	double Size() const { return std::sqrt(X * X + Y * Y + Z * Z); }
+	static double Dist(const FVector& A, const FVector& B) { return (A - B).Size(); }
+
+	FString ToString() const { return FString::Printf(TEXT("X=%3.3f Y=%3.3f Z=%3.3f"), X, Y, Z); }
+};
+
+inline constexpr FVector FVector::ZeroVector(0.0, 0.0, 0.0);
+inline constexpr FVector FVector::OneVector(1.0, 1.0, 1.0);
+
+FORCEINLINE constexpr FVector operator*(double Scale, const FVector& Vector)
+{
+	return Vector * Scale;
+}
+
+/* Containers
+ *****************************************************************************/
+
+struct FDefaultAllocator
+{
+};
+
+// Contiguous array with the engine's growth and Reset/SetNum semantics. Elements must be movable.
+template<typename T, typename InAllocator = FDefaultAllocator>
+class TArray
+{
+public:
+	using ElementType = T;
+
+	TArray() = default;
+
+	TArray(std::initializer_list<T> List)
+	{
+		Append(List.begin(), int32(List.size()));
+	}
+
+	TArray(const T* Ptr, int32 Count)
+	{
+		Append(Ptr, Count);
+	}
+
+	TArray(const TArray& Other)
+	{
+		Append(Other.GetData(), Other.Num());
+	}
+
+	TArray(TArray&& Other) noexcept
+		: Data(Other.Data)
+		, ArrayNum(Other.ArrayNum)
+		, ArrayMax(Other.ArrayMax)
+	{
+		Other.Data = nullptr;
+		Other.ArrayNum = 0;
+		Other.ArrayMax = 0;
+	}
+
+	~TArray()
+	{
+		DestructItems(0, ArrayNum);
+		Deallocate(Data, ArrayMax);
+	}
+
+	TArray& operator=(const TArray& Other)
+	{
+		if (this != &Other)
+		{
+			Reset(Other.Num());
+			Append(Other.GetData(), Other.Num());
+		}
+		return *this;
+	}
+
+	TArray& operator=(TArray&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			DestructItems(0, ArrayNum);
+			Deallocate(Data, ArrayMax);
+			Data = Other.Data;
+			ArrayNum = Other.ArrayNum;
+			ArrayMax = Other.ArrayMax;
+			Other.Data = nullptr;
+			Other.ArrayNum = 0;
+			Other.ArrayMax = 0;
+		}
+		return *this;
+	}
+
+	FORCEINLINE int32 Num() const { return ArrayNum; }
+	FORCEINLINE int32 Max() const { return ArrayMax; }
+	FORCEINLINE bool IsEmpty() const { return ArrayNum == 0; }
+	FORCEINLINE bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < ArrayNum; }
+
+	FORCEINLINE T* GetData() { return Data; }
+	FORCEINLINE const T* GetData() const { return Data; }
+
+	FORCEINLINE T& operator[](int32 Index) { check(IsValidIndex(Index)); return Data[Index]; }
+	FORCEINLINE const T& operator[](int32 Index) const { check(IsValidIndex(Index)); return Data[Index]; }
+
+	T& Last(int32 IndexFromTheEnd = 0) { return (*this)[ArrayNum - IndexFromTheEnd - 1]; }
+	const T& Last(int32 IndexFromTheEnd = 0) const { return (*this)[ArrayNum - IndexFromTheEnd - 1]; }
+	T& Top() { return Last(); }
+
+	int64 GetAllocatedSize() const { return int64(ArrayMax) * sizeof(T); }
+
+	void Reserve(int32 Number)
+	{
+		if (Number > ArrayMax)
+		{
+			Reallocate(Number);
+		}
+	}
+
+	// Destroys every element but keeps at least NewSize worth of memory
+	void Reset(int32 NewSize = 0)
+	{
+		DestructItems(0, ArrayNum);
+		ArrayNum = 0;
+		Reserve(NewSize);
+	}
+
+	// Destroys every element and frees memory beyond Slack
+	void Empty(int32 Slack = 0)
+	{
+		DestructItems(0, ArrayNum);
+		ArrayNum = 0;
+		if (ArrayMax != Slack)
+		{
+			Reallocate(Slack);
+		}
+	}
+
+	void Shrink()
+	{
+		if (ArrayMax != ArrayNum)
+		{
+			Reallocate(ArrayNum);
+		}
+	}
+
+	void SetNum(int32 NewNum, EAllowShrinking AllowShrinking = EAllowShrinking::Yes)
+	{
+		if (NewNum > ArrayNum)
+		{
+			const int32 Index = AddUninitialized(NewNum - ArrayNum);
+			for (int32 Item = Index; Item < NewNum; Item++)
+			{
+				new (Data + Item) T();
+			}
+		}
+		else if (NewNum < ArrayNum)
+		{
+			RemoveAt(NewNum, ArrayNum - NewNum, AllowShrinking);
+		}
+	}
+
+	void SetNumZeroed(int32 NewNum, EAllowShrinking AllowShrinking = EAllowShrinking::Yes)
+	{
+		if (NewNum > ArrayNum)
+		{
+			AddZeroed(NewNum - ArrayNum);
+		}
+		else if (NewNum < ArrayNum)
+		{
+			RemoveAt(NewNum, ArrayNum - NewNum, AllowShrinking);
+		}
+	}
+
+	// New elements are left uninitialized when T is trivial, default-constructed otherwise
+	void SetNumUninitialized(int32 NewNum, EAllowShrinking AllowShrinking = EAllowShrinking::Yes)
+	{
+		if (NewNum > ArrayNum)
+		{
+			const int32 Index = AddUninitialized(NewNum - ArrayNum);
+			if constexpr (!std::is_trivially_default_constructible_v<T>)
+			{
+				for (int32 Item = Index; Item < NewNum; Item++)
+				{
+					new (Data + Item) T();
+				}
+			}
+		}
+		else if (NewNum < ArrayNum)
+		{
+			RemoveAt(NewNum, ArrayNum - NewNum, AllowShrinking);
+		}
+	}
+
+	void Init(const T& Element, int32 Number)
+	{
+		Reset(Number);
+		for (int32 Index = 0; Index < Number; Index++)
+		{
+			new (Data + Index) T(Element);
+		}
+		ArrayNum = Number;
+	}
+
+	int32 AddUninitialized(int32 Count = 1)
+	{
+		const int32 OldNum = ArrayNum;
+		if (OldNum + Count > ArrayMax)
+		{
+			Reallocate(GrowTo(OldNum + Count));
+		}
+		ArrayNum += Count;
+		return OldNum;
+	}
+
+	int32 AddZeroed(int32 Count = 1)
+	{
+		const int32 Index = AddUninitialized(Count);
+		std::memset(static_cast<void*>(Data + Index), 0, sizeof(T) * Count);
+		return Index;
+	}
+
+	int32 AddDefaulted(int32 Count = 1)
+	{
+		const int32 Index = AddUninitialized(Count);
+		for (int32 Item = Index; Item < Index + Count; Item++)
+		{
+			new (Data + Item) T();
+		}
+		return Index;
+	}
+
+	T& AddDefaulted_GetRef()
+	{
+		const int32 Index = AddDefaulted();
+		return Data[Index];
+	}
+
+	template<typename... ArgsType>
+	int32 Emplace(ArgsType&&... Args)
+	{
+		// Construct before growing, Args may point into this array
+		T Element(Forward<ArgsType>(Args)...);
+		const int32 Index = AddUninitialized();
+		new (Data + Index) T(MoveTemp(Element));
+		return Index;
+	}
+
+	template<typename... ArgsType>
+	T& Emplace_GetRef(ArgsType&&... Args)
+	{
+		// Emplace may reallocate, so index only after it returns
+		const int32 Index = Emplace(Forward<ArgsType>(Args)...);
+		return Data[Index];
+	}
+
+	int32 Add(const T& Item) { return Emplace(Item); }
+	int32 Add(T&& Item) { return Emplace(MoveTemp(Item)); }
+	T& Add_GetRef(const T& Item) { return Emplace_GetRef(Item); }
+	T& Add_GetRef(T&& Item) { return Emplace_GetRef(MoveTemp(Item)); }
+	void Push(const T& Item) { Add(Item); }
+	void Push(T&& Item) { Add(MoveTemp(Item)); }
+
+	int32 AddUnique(const T& Item)
+	{
+		const int32 Index = Find(Item);
+		return Index != INDEX_NONE ? Index : Add(Item);
+	}
+
+	void Append(const T* Ptr, int32 Count)
+	{
+		Reserve(ArrayNum + Count);
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			new (Data + ArrayNum + Index) T(Ptr[Index]);
+		}
+		ArrayNum += Count;
+	}
+
+	void Append(const TArray& Other)
+	{
+		if (this == &Other)
+		{
+			const TArray Copy = Other;
+			Append(Copy.GetData(), Copy.Num());
+			return;
+		}
+		Append(Other.GetData(), Other.Num());
+	}
+
+	void Append(TArray&& Other)
+	{
+		Reserve(ArrayNum + Other.Num());
+		for (int32 Index = 0; Index < Other.Num(); Index++)
+		{
+			new (Data + ArrayNum + Index) T(MoveTemp(Other.Data[Index]));
+		}
+		ArrayNum += Other.Num();
+		Other.Reset();
+	}
+
+	void Insert(const T& Item, int32 Index)
+	{
+		T Copy = Item;
+		Add(MoveTemp(Copy));
+		std::rotate(Data + Index, Data + ArrayNum - 1, Data + ArrayNum);
+	}
+
+	T Pop(EAllowShrinking AllowShrinking = EAllowShrinking::Yes)
+	{
+		T Result = MoveTemp(Data[ArrayNum - 1]);
+		RemoveAt(ArrayNum - 1, 1, AllowShrinking);
+		return Result;
+	}
+
+	void RemoveAt(int32 Index, int32 Count = 1, EAllowShrinking AllowShrinking = EAllowShrinking::Yes)
+	{
+		check(Index >= 0 && Count >= 0 && Index + Count <= ArrayNum);
+		std::move(Data + Index + Count, Data + ArrayNum, Data + Index);
+		DestructItems(ArrayNum - Count, ArrayNum);
+		ArrayNum -= Count;
+		if (AllowShrinking == EAllowShrinking::Yes && ArrayNum * 4 < ArrayMax)
+		{
+			Shrink();
+		}
+	}
+
+	void RemoveAt(int32 Index, EAllowShrinking AllowShrinking)
+	{
+		RemoveAt(Index, 1, AllowShrinking);
+	}
+
+	void RemoveAtSwap(int32 Index, int32 Count = 1, EAllowShrinking AllowShrinking = EAllowShrinking::Yes)
+	{
+		for (int32 Item = 0; Item < Count; Item++)
+		{
+			if (Index + Item != ArrayNum - 1 - Item)
+			{
+				Data[Index + Item] = MoveTemp(Data[ArrayNum - 1 - Item]);
+			}
+		}
+		DestructItems(ArrayNum - Count, ArrayNum);
+		ArrayNum -= Count;
+		if (AllowShrinking == EAllowShrinking::Yes && ArrayNum * 4 < ArrayMax)
+		{
+			Shrink();
+		}
+	}
+
+	int32 Remove(const T& Item)
+	{
+		const int32 OldNum = ArrayNum;
+		T* NewEnd = std::remove(Data, Data + ArrayNum, Item);
+		const int32 NewNum = int32(NewEnd - Data);
+		DestructItems(NewNum, ArrayNum);
+		ArrayNum = NewNum;
+		return OldNum - NewNum;
+	}
+
+	template<typename PredicateType>
+	int32 RemoveAll(PredicateType Predicate)
+	{
+		const int32 OldNum = ArrayNum;
+		T* NewEnd = std::remove_if(Data, Data + ArrayNum, Predicate);
+		const int32 NewNum = int32(NewEnd - Data);
+		DestructItems(NewNum, ArrayNum);
+		ArrayNum = NewNum;
+		return OldNum - NewNum;
+	}
+
+	int32 Find(const T& Item) const
+	{
+		for (int32 Index = 0; Index < ArrayNum; Index++)
+		{
+			if (Data[Index] == Item)
+			{
+				return Index;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	bool Contains(const T& Item) const
+	{
+		return Find(Item) != INDEX_NONE;
+	}
+
+	template<typename PredicateType>
+	int32 IndexOfByPredicate(PredicateType Predicate) const
+	{
+		for (int32 Index = 0; Index < ArrayNum; Index++)
+		{
+			if (Predicate(Data[Index]))
+			{
+				return Index;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	template<typename PredicateType>
+	bool ContainsByPredicate(PredicateType Predicate) const
+	{
+		return IndexOfByPredicate(Predicate) != INDEX_NONE;
+	}
+
+	void Sort()
+	{
+		std::sort(Data, Data + ArrayNum);
+	}
+
+	template<typename PredicateType>
+	void Sort(PredicateType Predicate)
+	{
+		std::sort(Data, Data + ArrayNum, Predicate);
+	}
+
+	template<typename PredicateType>
+	void StableSort(PredicateType Predicate)
+	{
+		std::stable_sort(Data, Data + ArrayNum, Predicate);
+	}
+
+	// Heaps keep the element that sorts first according to Predicate on top
+	template<typename PredicateType>
+	void Heapify(PredicateType Predicate)
+	{
+		std::make_heap(Data, Data + ArrayNum, FReversePredicate<PredicateType>{ Predicate });
+	}
+
+	template<typename PredicateType>
+	int32 HeapPush(const T& Item, PredicateType Predicate)
+	{
+		Add(Item);
+		std::push_heap(Data, Data + ArrayNum, FReversePredicate<PredicateType>{ Predicate });
+		return ArrayNum - 1;
+	}
+
+	template<typename PredicateType>
+	void HeapPop(T& OutItem, PredicateType Predicate, EAllowShrinking AllowShrinking = EAllowShrinking::Yes)
+	{
+		std::pop_heap(Data, Data + ArrayNum, FReversePredicate<PredicateType>{ Predicate });
+		OutItem = Pop(AllowShrinking);
+	}
+
+	const T& HeapTop() const
+	{
+		return Data[0];
+	}
+
+	bool operator==(const TArray& Other) const
+	{
+		return ArrayNum == Other.ArrayNum && std::equal(Data, Data + ArrayNum, Other.Data);
+	}
+
+	bool operator!=(const TArray& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	FORCEINLINE T* begin() { return Data; }
+	FORCEINLINE T* end() { return Data + ArrayNum; }
+	FORCEINLINE const T* begin() const { return Data; }
+	FORCEINLINE const T* end() const { return Data + ArrayNum; }
+
+private:
+	template<typename PredicateType>
+	struct FReversePredicate
+	{
+		PredicateType& Predicate;
+		bool operator()(const T& A, const T& B) const { return Predicate(B, A); }
+	};
+
+	static int32 GrowTo(int32 Needed)
+	{
+		return FMath::Max(Needed, FMath::Max(4, Needed + Needed * 3 / 8 + 16));
+	}
+
+	static T* Allocate(int32 Count)
+	{
+		return Count > 0 ? std::allocator<T>().allocate(size_t(Count)) : nullptr;
+	}
+
+	static void Deallocate(T* Ptr, int32 Count)
+	{
+		if (Ptr)
+		{
+			std::allocator<T>().deallocate(Ptr, size_t(Count));
+		}
+	}
+
+	void DestructItems(int32 Begin, int32 End)
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			for (int32 Index = Begin; Index < End; Index++)
+			{
+				Data[Index].~T();
+			}
+		}
+	}
+
+	void Reallocate(int32 NewMax)
+	{
+		T* NewData = Allocate(NewMax);
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			if (NewData && Data && ArrayNum > 0)
+			{
+				std::memcpy(static_cast<void*>(NewData), Data, sizeof(T) * ArrayNum);
+			}
+		}
+		else
+		{
+			for (int32 Index = 0; Index < ArrayNum; Index++)
+			{
+				new (NewData + Index) T(MoveTemp(Data[Index]));
+				Data[Index].~T();
+			}
+		}
+		Deallocate(Data, ArrayMax);
+		Data = NewData;
+		ArrayMax = NewMax;
+	}
+
+	T* Data = nullptr;
+	int32 ArrayNum = 0;
+	int32 ArrayMax = 0;
+};
+
+template<typename T>
+class TArrayView
+{
+public:
+	TArrayView() = default;
+	TArrayView(T* InData, int32 InNum) : Data(InData), ArrayNum(InNum) {}
+
+	template<typename OtherType, typename = std::enable_if_t<std::is_same_v<std::remove_const_t<T>, OtherType>>>
+	TArrayView(const TArray<OtherType>& Array) : Data(Array.GetData()), ArrayNum(Array.Num()) {}
+
+	template<typename OtherType, typename = std::enable_if_t<std::is_same_v<std::remove_const_t<T>, OtherType>>>
+	TArrayView(TArray<OtherType>& Array) : Data(Array.GetData()), ArrayNum(Array.Num()) {}
+
+	FORCEINLINE int32 Num() const { return ArrayNum; }
+	FORCEINLINE T* GetData() const { return Data; }
+	FORCEINLINE T& operator[](int32 Index) const { check(Index >= 0 && Index < ArrayNum); return Data[Index]; }
+	FORCEINLINE T* begin() const { return Data; }
+	FORCEINLINE T* end() const { return Data + ArrayNum; }
+
+private:
+	T* Data = nullptr;
+	int32 ArrayNum = 0;
+};
+
+template<typename T>
+using TConstArrayView = TArrayView<const T>;
+
+template<typename KeyType>
+struct TShimKeyHash
+{
+	size_t operator()(const KeyType& Key) const { return GetTypeHash(Key); }
+};
+
+template<typename T>
+class TSet
+{
+public:
+	void Add(const T& Element, bool* bIsAlreadyInSetPtr = nullptr)
+	{
+		const bool bInserted = Elements.insert(Element).second;
+		if (bIsAlreadyInSetPtr)
+		{
+			*bIsAlreadyInSetPtr = !bInserted;
+		}
+	}
+
+	void Append(const TSet& Other)
+	{
+		Elements.insert(Other.Elements.begin(), Other.Elements.end());
+	}
+
+	void Append(const TArray<T>& Other)
+	{
+		Elements.insert(Other.begin(), Other.end());
+	}
+
+	bool Contains(const T& Element) const { return Elements.count(Element) != 0; }
+	const T* Find(const T& Element) const
+	{
+		const auto It = Elements.find(Element);
+		return It != Elements.end() ? &*It : nullptr;
+	}
+	int32 Remove(const T& Element) { return int32(Elements.erase(Element)); }
+
+	int32 Num() const { return int32(Elements.size()); }
+	void Reserve(int32 Number) { Elements.reserve(size_t(Number)); }
+	void Reset() { Elements.clear(); }
+	void Empty(int32 Slack = 0) { Elements = {}; Elements.reserve(size_t(Slack)); }
+
+	int64 GetAllocatedSize() const
+	{
+		return int64(Elements.bucket_count()) * sizeof(void*) + int64(Elements.size()) * int64(sizeof(T) + sizeof(void*));
+	}
+
+	TArray<T> Array() const
+	{
+		TArray<T> Result;
+		Result.Reserve(Num());
+		for (const T& Element : Elements)
+		{
+			Result.Add(Element);
+		}
+		return Result;
+	}
+
+	auto begin() const { return Elements.begin(); }
+	auto end() const { return Elements.end(); }
+
+private:
+	std::unordered_set<T, TShimKeyHash<T>> Elements;
+};
+
+template<typename KeyType, typename ValueType>
+class TMap
+{
+	using FStorage = std::unordered_map<KeyType, ValueType, TShimKeyHash<KeyType>>;
+
+public:
+	template<typename InValueType>
+	struct TPairRef
+	{
+		const KeyType& Key;
+		InValueType& Value;
+	};
+
+	template<typename IteratorType, typename InValueType>
+	class TRangeIterator
+	{
+	public:
+		explicit TRangeIterator(IteratorType InIt) : It(InIt) {}
+		TPairRef<InValueType> operator*() const { return { It->first, It->second }; }
+		TRangeIterator& operator++() { ++It; return *this; }
+		bool operator!=(const TRangeIterator& Other) const { return It != Other.It; }
+
+	private:
+		IteratorType It;
+	};
+
+	class TIterator
+	{
+	public:
+		explicit TIterator(FStorage& InMap) : Map(InMap), It(InMap.begin()) {}
+
+		explicit operator bool() const { return It != Map.end(); }
+		const KeyType& Key() const { return It->first; }
+		ValueType& Value() const { return It->second; }
+
+		TIterator& operator++()
+		{
+			if (bRemoved)
+			{
+				bRemoved = false;
+			}
+			else
+			{
+				++It;
+			}
+			return *this;
+		}
+
+		void RemoveCurrent()
+		{
+			It = Map.erase(It);
+			bRemoved = true;
+		}
+
+	private:
+		FStorage& Map;
+		typename FStorage::iterator It;
+		bool bRemoved = false;
+	};
+
+	ValueType& Add(const KeyType& Key, const ValueType& Value) { return Map.insert_or_assign(Key, Value).first->second; }
+	ValueType& Add(const KeyType& Key, ValueType&& Value) { return Map.insert_or_assign(Key, MoveTemp(Value)).first->second; }
+	ValueType& Add(const KeyType& Key) { return Map.insert_or_assign(Key, ValueType()).first->second; }
+	ValueType& Emplace(const KeyType& Key, ValueType&& Value) { return Add(Key, MoveTemp(Value)); }
+
+	ValueType& FindOrAdd(const KeyType& Key) { return Map[Key]; }
+	ValueType& FindOrAdd(const KeyType& Key, const ValueType& Default) { return Map.try_emplace(Key, Default).first->second; }
+
+	ValueType* Find(const KeyType& Key)
+	{
+		const auto It = Map.find(Key);
+		return It != Map.end() ? &It->second : nullptr;
+	}
+
+	const ValueType* Find(const KeyType& Key) const
+	{
+		const auto It = Map.find(Key);
+		return It != Map.end() ? &It->second : nullptr;
+	}
+
+	ValueType& FindChecked(const KeyType& Key) { ValueType* Value = Find(Key); check(Value); return *Value; }
+	const ValueType& FindChecked(const KeyType& Key) const { const ValueType* Value = Find(Key); check(Value); return *Value; }
+
+	ValueType FindRef(const KeyType& Key) const
+	{
+		const ValueType* Value = Find(Key);
+		return Value ? *Value : ValueType();
+	}
+
+	bool Contains(const KeyType& Key) const { return Map.count(Key) != 0; }
+	int32 Remove(const KeyType& Key) { return int32(Map.erase(Key)); }
+
+	bool RemoveAndCopyValue(const KeyType& Key, ValueType& OutValue)
+	{
+		const auto It = Map.find(Key);
+		if (It == Map.end())
+		{
+			return false;
+		}
+		OutValue = MoveTemp(It->second);
+		Map.erase(It);
+		return true;
+	}
+
+	int32 Num() const { return int32(Map.size()); }
+	void Reserve(int32 Number) { Map.reserve(size_t(Number)); }
+	void Reset() { Map.clear(); }
+	void Empty(int32 Slack = 0) { Map = {}; Map.reserve(size_t(Slack)); }
+
+	int64 GetAllocatedSize() const
+	{
+		return int64(Map.bucket_count()) * sizeof(void*) + int64(Map.size()) * int64(sizeof(KeyType) + sizeof(ValueType) + sizeof(void*));
+	}
+
+	TIterator CreateIterator() { return TIterator(Map); }
+
+	TRangeIterator<typename FStorage::iterator, ValueType> begin() { return TRangeIterator<typename FStorage::iterator, ValueType>(Map.begin()); }
+	TRangeIterator<typename FStorage::iterator, ValueType> end() { return TRangeIterator<typename FStorage::iterator, ValueType>(Map.end()); }
+	TRangeIterator<typename FStorage::const_iterator, const ValueType> begin() const { return TRangeIterator<typename FStorage::const_iterator, const ValueType>(Map.begin()); }
+	TRangeIterator<typename FStorage::const_iterator, const ValueType> end() const { return TRangeIterator<typename FStorage::const_iterator, const ValueType>(Map.end()); }
+
+private:
+	FStorage Map;
+};
+
+/* Smart pointers
+ *****************************************************************************/
+
+template<typename T>
+class TUniquePtr
+{
+public:
+	TUniquePtr() = default;
+	TUniquePtr(std::nullptr_t) {}
+	explicit TUniquePtr(T* InPtr) : Ptr(InPtr) {}
+
+	template<typename OtherType, typename = std::enable_if_t<std::is_convertible_v<OtherType*, T*>>>
+	TUniquePtr(TUniquePtr<OtherType>&& Other) : Ptr(Other.Release()) {}
+
+	TUniquePtr(TUniquePtr&&) noexcept = default;
+	TUniquePtr& operator=(TUniquePtr&&) noexcept = default;
+
+	T* Get() const { return Ptr.get(); }
+	T* Release() { return Ptr.release(); }
+	void Reset(T* InPtr = nullptr) { Ptr.reset(InPtr); }
+	bool IsValid() const { return Ptr != nullptr; }
+	explicit operator bool() const { return IsValid(); }
+
+	T* operator->() const { return Ptr.get(); }
+	T& operator*() const { return *Ptr; }
+
+private:
+	std::unique_ptr<T> Ptr;
+};
+
+template<typename T, typename... ArgsType>
+TUniquePtr<T> MakeUnique(ArgsType&&... Args)
+{
+	return TUniquePtr<T>(new T(Forward<ArgsType>(Args)...));
+}
+
+template<typename T>
+class TSharedPtr
+{
+public:
+	TSharedPtr() = default;
+	TSharedPtr(std::nullptr_t) {}
+	explicit TSharedPtr(std::shared_ptr<T> InPtr) : Ptr(MoveTemp(InPtr)) {}
+
+	template<typename OtherType, typename = std::enable_if_t<std::is_convertible_v<OtherType*, T*>>>
+	TSharedPtr(const TSharedPtr<OtherType>& Other) : Ptr(Other.Ptr) {}
+
+	T* Get() const { return Ptr.get(); }
+	void Reset() { Ptr.reset(); }
+	bool IsValid() const { return Ptr != nullptr; }
+	explicit operator bool() const { return IsValid(); }
+
+	T* operator->() const { return Ptr.get(); }
+	T& operator*() const { return *Ptr; }
+
+	bool operator==(const TSharedPtr& Other) const { return Ptr == Other.Ptr; }
+	bool operator!=(const TSharedPtr& Other) const { return Ptr != Other.Ptr; }
+
+private:
+	template<typename OtherType>
+	friend class TSharedPtr;
+
+	std::shared_ptr<T> Ptr;
+};
+
+template<typename T, typename... ArgsType>
+TSharedPtr<T> MakeShared(ArgsType&&... Args)
+{
+	return TSharedPtr<T>(std::make_shared<T>(Forward<ArgsType>(Args)...));
+}
+
+template<typename T>
+class TOptional
+{
+public:
+	TOptional() = default;
+	TOptional(const T& InValue) : Value(InValue) {}
+	TOptional(T&& InValue) : Value(MoveTemp(InValue)) {}
+
+	template<typename... ArgsType>
+	T& Emplace(ArgsType&&... Args)
+	{
+		return Value.emplace(Forward<ArgsType>(Args)...);
+	}
+
+	bool IsSet() const { return Value.has_value(); }
+	void Reset() { Value.reset(); }
+	T& GetValue() { return *Value; }
+	const T& GetValue() const { return *Value; }
+	T* operator->() { return &*Value; }
+	const T* operator->() const { return &*Value; }
+
+private:
+	std::optional<T> Value;
+};
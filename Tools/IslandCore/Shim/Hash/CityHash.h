@@ -0,0 +1,28 @@
+// CityHash.h
+// Standalone stand-in for the engine's CityHash64. Any good 64-bit hash works here: the core only
+// compares hashes of the same buffers with each other.
+#pragma once
+
+#include "CoreMinimal.h"
+
+inline uint64 CityHash64(const char* Buffer, uint32 Length)
+{
+	// FNV-1a over 8-byte words, then a final avalanche
+	uint64 Hash = 14695981039346656037ull ^ Length;
+	uint32 Offset = 0;
+	for (; Offset + 8 <= Length; Offset += 8)
+	{
+		uint64 Word;
+		std::memcpy(&Word, Buffer + Offset, 8);
+		Hash = (Hash ^ Word) * 1099511628211ull;
+	}
+	for (; Offset < Length; Offset++)
+	{
+		Hash = (Hash ^ uint8(Buffer[Offset])) * 1099511628211ull;
+	}
+
+	Hash ^= Hash >> 33;
+	Hash *= 0xff51afd7ed558ccdull;
+	Hash ^= Hash >> 33;
+	return Hash;
+}
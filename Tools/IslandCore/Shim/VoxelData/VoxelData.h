@@ -0,0 +1,288 @@
+// VoxelData.h
+// Standalone stand-in for the voxel plugin's FVoxelData: a sparse grid of 16^3 chunks that tests and
+// benchmarks author directly. Only the API the island core calls is mirrored; voxels outside any chunk
+// read as empty. Reads may run on several threads at once, writes may not overlap reads.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelValue.h"
+#include "VoxelMaterial.h"
+#include "VoxelIntBox.h"
+#include "VoxelQueryZone.h"
+
+class FVoxelData
+{
+public:
+	static constexpr int32 ChunkShift = 4;
+	static constexpr int32 ChunkSize = 1 << ChunkShift;
+	static constexpr int32 ChunkVolume = ChunkSize * ChunkSize * ChunkSize;
+
+	FVoxelData() = default;
+	FVoxelData(const FVoxelData&) = delete;
+	FVoxelData& operator=(const FVoxelData&) = delete;
+
+	/* Plugin read API
+	 *****************************************************************************/
+
+	// Fills the zone's array, X fastest, in one pass per overlapping chunk
+	template<typename T>
+	void Get(TVoxelQueryZone<T>& Zone, int32 LOD) const
+	{
+		NumBulkQueries++;
+
+		const FVoxelIntBox& Bounds = Zone.Bounds;
+		const FIntVector Size = Bounds.Size();
+		T* Out = Zone.Array.GetData();
+		for (int64 Index = 0; Index < Bounds.Count(); Index++)
+		{
+			Out[Index] = T();
+		}
+
+		const FIntVector ChunkMin = GetChunkCoord(Bounds.Min);
+		const FIntVector ChunkMax = GetChunkCoord(Bounds.Max - FIntVector(1));
+		for (int32 CZ = ChunkMin.Z; CZ <= ChunkMax.Z; CZ++)
+		{
+			for (int32 CY = ChunkMin.Y; CY <= ChunkMax.Y; CY++)
+			{
+				for (int32 CX = ChunkMin.X; CX <= ChunkMax.X; CX++)
+				{
+					const TUniquePtr<FChunk>* Chunk = Chunks.Find(FIntVector(CX, CY, CZ));
+					const T* Source = Chunk ? (*Chunk)->template GetArray<T>() : nullptr;
+					if (!Source)
+					{
+						continue;
+					}
+
+					// Copy the rows of the part of the chunk inside the zone
+					const FIntVector Origin = FIntVector(CX, CY, CZ) * ChunkSize;
+					const FIntVector Min(FMath::Max(Bounds.Min.X, Origin.X), FMath::Max(Bounds.Min.Y, Origin.Y), FMath::Max(Bounds.Min.Z, Origin.Z));
+					const FIntVector Max(FMath::Min(Bounds.Max.X, Origin.X + ChunkSize), FMath::Min(Bounds.Max.Y, Origin.Y + ChunkSize), FMath::Min(Bounds.Max.Z, Origin.Z + ChunkSize));
+					for (int32 Z = Min.Z; Z < Max.Z; Z++)
+					{
+						for (int32 Y = Min.Y; Y < Max.Y; Y++)
+						{
+							const T* Row = Source + GetChunkIndex(FIntVector(Min.X, Y, Z) - Origin);
+							T* OutRow = Out + (int64(Z - Bounds.Min.Z) * Size.Y + (Y - Bounds.Min.Y)) * Size.X + (Min.X - Bounds.Min.X);
+							std::copy(Row, Row + (Max.X - Min.X), OutRow);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	FVoxelValue GetValue(const FIntVector& Pos, int32 LOD) const
+	{
+		NumPointQueries++;
+		const TUniquePtr<FChunk>* Chunk = Chunks.Find(GetChunkCoord(Pos));
+		return Chunk ? (*Chunk)->Values[GetChunkIndex(Pos - GetChunkCoord(Pos) * ChunkSize)] : FVoxelValue();
+	}
+
+	FVoxelMaterial GetMaterial(const FIntVector& Pos, int32 LOD) const
+	{
+		NumPointQueries++;
+		const TUniquePtr<FChunk>* Chunk = Chunks.Find(GetChunkCoord(Pos));
+		return Chunk && (*Chunk)->Materials.Num() > 0 ? (*Chunk)->Materials[GetChunkIndex(Pos - GetChunkCoord(Pos) * ChunkSize)] : FVoxelMaterial();
+	}
+
+	/* Plugin write API
+	 *****************************************************************************/
+
+	// Calls Apply(X, Y, Z, Value) on every voxel of the box, one pass per overlapping chunk, X fastest
+	// within a chunk. Chunks are allocated as needed.
+	template<typename T, typename F>
+	void Set(const FVoxelIntBox& Bounds, F Apply)
+	{
+		NumBulkWrites++;
+
+		const FIntVector ChunkMin = GetChunkCoord(Bounds.Min);
+		const FIntVector ChunkMax = GetChunkCoord(Bounds.Max - FIntVector(1));
+		for (int32 CZ = ChunkMin.Z; CZ <= ChunkMax.Z; CZ++)
+		{
+			for (int32 CY = ChunkMin.Y; CY <= ChunkMax.Y; CY++)
+			{
+				for (int32 CX = ChunkMin.X; CX <= ChunkMax.X; CX++)
+				{
+					FChunk& Chunk = FindOrAddChunk(FIntVector(CX, CY, CZ));
+					T* Target = Chunk.template GetMutableArray<T>();
+
+					const FIntVector Origin = FIntVector(CX, CY, CZ) * ChunkSize;
+					const FIntVector Min(FMath::Max(Bounds.Min.X, Origin.X), FMath::Max(Bounds.Min.Y, Origin.Y), FMath::Max(Bounds.Min.Z, Origin.Z));
+					const FIntVector Max(FMath::Min(Bounds.Max.X, Origin.X + ChunkSize), FMath::Min(Bounds.Max.Y, Origin.Y + ChunkSize), FMath::Min(Bounds.Max.Z, Origin.Z + ChunkSize));
+					for (int32 Z = Min.Z; Z < Max.Z; Z++)
+					{
+						for (int32 Y = Min.Y; Y < Max.Y; Y++)
+						{
+							for (int32 X = Min.X; X < Max.X; X++)
+							{
+								Apply(X, Y, Z, Target[GetChunkIndex(FIntVector(X, Y, Z) - Origin)]);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	/* Authoring, for tests and benchmarks
+	 *****************************************************************************/
+
+	void SetValue(const FIntVector& Pos, FVoxelValue Value)
+	{
+		FChunk& Chunk = FindOrAddChunk(GetChunkCoord(Pos));
+		Chunk.Values[GetChunkIndex(Pos - GetChunkCoord(Pos) * ChunkSize)] = Value;
+	}
+
+	void SetMaterial(const FIntVector& Pos, FVoxelMaterial Material)
+	{
+		FChunk& Chunk = FindOrAddChunk(GetChunkCoord(Pos));
+		if (Chunk.Materials.Num() == 0)
+		{
+			Chunk.Materials.SetNum(ChunkVolume);
+		}
+		Chunk.Materials[GetChunkIndex(Pos - GetChunkCoord(Pos) * ChunkSize)] = Material;
+	}
+
+	void SetSolid(const FIntVector& Pos, bool bSolid)
+	{
+		SetValue(Pos, bSolid ? FVoxelValue::Full() : FVoxelValue::Empty());
+	}
+
+	bool IsSolid(const FIntVector& Pos) const
+	{
+		return !GetValue(Pos, 0).IsEmpty();
+	}
+
+	// Inclusive box
+	void SetBox(const FIntVector& Min, const FIntVector& Max, bool bSolid)
+	{
+		for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+		{
+			for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+			{
+				for (int32 X = Min.X; X <= Max.X; X++)
+				{
+					SetSolid(FIntVector(X, Y, Z), bSolid);
+				}
+			}
+		}
+	}
+
+	void SetSphere(const FIntVector& Center, int32 Radius, bool bSolid)
+	{
+		for (int32 Z = -Radius; Z <= Radius; Z++)
+		{
+			for (int32 Y = -Radius; Y <= Radius; Y++)
+			{
+				for (int32 X = -Radius; X <= Radius; X++)
+				{
+					if (X * X + Y * Y + Z * Z <= Radius * Radius)
+					{
+						SetSolid(Center + FIntVector(X, Y, Z), bSolid);
+					}
+				}
+			}
+		}
+	}
+
+	void Clear()
+	{
+		Chunks.Reset();
+	}
+
+	int32 GetNumChunks() const { return Chunks.Num(); }
+
+	// How many bulk and single-voxel reads and bulk writes the core issued, to check that access is batched or skipped
+	int64 GetNumBulkQueries() const { return NumBulkQueries; }
+	int64 GetNumPointQueries() const { return NumPointQueries; }
+	int64 GetNumBulkWrites() const { return NumBulkWrites; }
+	void ResetQueryCounts()
+	{
+		NumBulkQueries = 0;
+		NumPointQueries = 0;
+		NumBulkWrites = 0;
+	}
+
+private:
+	struct FChunk
+	{
+		TArray<FVoxelValue> Values;
+
+		// Allocated by the first SetMaterial
+		TArray<FVoxelMaterial> Materials;
+
+		template<typename T>
+		const T* GetArray() const
+		{
+			if constexpr (std::is_same_v<T, FVoxelValue>)
+			{
+				return Values.GetData();
+			}
+			else
+			{
+				return Materials.Num() > 0 ? Materials.GetData() : nullptr;
+			}
+		}
+
+		template<typename T>
+		T* GetMutableArray()
+		{
+			if constexpr (std::is_same_v<T, FVoxelValue>)
+			{
+				return Values.GetData();
+			}
+			else
+			{
+				if (Materials.Num() == 0)
+				{
+					Materials.SetNum(ChunkVolume);
+				}
+				return Materials.GetData();
+			}
+		}
+	};
+
+	static FIntVector GetChunkCoord(const FIntVector& Pos)
+	{
+		return FIntVector(Pos.X >> ChunkShift, Pos.Y >> ChunkShift, Pos.Z >> ChunkShift);
+	}
+
+	// Local position inside the chunk, X fastest
+	static int32 GetChunkIndex(const FIntVector& Local)
+	{
+		return Local.X + ChunkSize * (Local.Y + ChunkSize * Local.Z);
+	}
+
+	FChunk& FindOrAddChunk(const FIntVector& ChunkCoord)
+	{
+		TUniquePtr<FChunk>& Chunk = Chunks.FindOrAdd(ChunkCoord);
+		if (!Chunk.IsValid())
+		{
+			Chunk = MakeUnique<FChunk>();
+			Chunk->Values.Init(FVoxelValue::Empty(), ChunkVolume);
+		}
+		return *Chunk;
+	}
+
+	TMap<FIntVector, TUniquePtr<FChunk>> Chunks;
+
+	mutable std::atomic<int64> NumBulkQueries{ 0 };
+	mutable std::atomic<int64> NumPointQueries{ 0 };
+	int64 NumBulkWrites = 0;
+};
+
+// The plugin's locks guard the octree against concurrent edits. Authoring here never overlaps reads,
+// so they only mirror the constructors.
+struct FVoxelReadScopeLock
+{
+	FVoxelReadScopeLock(const FVoxelData& Data, const FVoxelIntBox& Bounds, const char* Name)
+	{
+	}
+};
+
+struct FVoxelWriteScopeLock
+{
+	FVoxelWriteScopeLock(FVoxelData& Data, const FVoxelIntBox& Bounds, const char* Name)
+	{
+	}
+};
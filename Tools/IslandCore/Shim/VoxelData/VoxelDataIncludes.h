@@ -0,0 +1,4 @@
+// VoxelDataIncludes.h
+#pragma once
+
+#include "VoxelData/VoxelData.h"
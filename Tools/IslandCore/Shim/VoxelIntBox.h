@@ -0,0 +1,21 @@
+// VoxelIntBox.h
+// Standalone stand-in for the voxel plugin's integer box: Min inclusive, Max exclusive
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FVoxelIntBox
+{
+	FIntVector Min = FIntVector::ZeroValue;
+	FIntVector Max = FIntVector::ZeroValue;
+
+	static const FVoxelIntBox Infinite;
+
+	FVoxelIntBox() = default;
+	FVoxelIntBox(const FIntVector& InMin, const FIntVector& InMax) : Min(InMin), Max(InMax) {}
+
+	FIntVector Size() const { return Max - Min; }
+	int64 Count() const { return int64(Max.X - Min.X) * (Max.Y - Min.Y) * (Max.Z - Min.Z); }
+};
+
+inline const FVoxelIntBox FVoxelIntBox::Infinite(FIntVector(MIN_int32 / 2), FIntVector(MAX_int32 / 2));
@@ -0,0 +1,14 @@
+// VoxelMaterial.h
+// Standalone stand-in for the voxel plugin's per-voxel material
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FVoxelMaterial
+{
+	uint32 Color = 0;
+
+	static FVoxelMaterial Default() { return FVoxelMaterial(); }
+
+	bool operator==(const FVoxelMaterial& Other) const { return Color == Other.Color; }
+};
@@ -0,0 +1,20 @@
+// VoxelQueryZone.h
+// Standalone stand-in for the voxel plugin's bulk query target: a box and an X-fastest array for it
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelIntBox.h"
+
+template<typename T>
+struct TVoxelQueryZone
+{
+	FVoxelIntBox Bounds;
+	TArray<T>& Array;
+
+	TVoxelQueryZone(const FVoxelIntBox& InBounds, TArray<T>& InArray)
+		: Bounds(InBounds)
+		, Array(InArray)
+	{
+		check(Array.Num() >= Bounds.Count());
+	}
+};
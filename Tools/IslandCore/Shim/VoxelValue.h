@@ -0,0 +1,20 @@
+// VoxelValue.h
+// Standalone stand-in for the voxel plugin's density value: negative is solid, positive is empty
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FVoxelValue
+{
+	int16 Density = 0x7fff;
+
+	FVoxelValue() = default;
+	explicit FVoxelValue(int16 InDensity) : Density(InDensity) {}
+
+	static FVoxelValue Full() { return FVoxelValue(int16(-0x7fff)); }
+	static FVoxelValue Empty() { return FVoxelValue(int16(0x7fff)); }
+
+	bool IsEmpty() const { return Density > 0; }
+
+	bool operator==(const FVoxelValue& Other) const { return Density == Other.Density; }
+};
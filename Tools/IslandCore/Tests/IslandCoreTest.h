@@ -0,0 +1,87 @@
+// IslandCoreTest.h
+// Minimal self-registering test harness for the standalone island core, no external dependencies.
+// ISLAND_TEST(Suite, Name) defines a test; the runner takes an optional suite name to run only that suite.
+#pragma once
+
+#include "CoreMinimal.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+struct FIslandCoreTest
+{
+	const char* Suite;
+	const char* Name;
+	void (*Function)();
+
+	static std::vector<FIslandCoreTest>& GetRegistry()
+	{
+		static std::vector<FIslandCoreTest> Registry;
+		return Registry;
+	}
+
+	// Failed checks of the running test
+	static int32& GetNumFailures()
+	{
+		static int32 NumFailures = 0;
+		return NumFailures;
+	}
+
+	static void Fail(const char* File, int32 Line, const std::string& Message)
+	{
+		std::printf("  %s:%d: %s\n", File, Line, Message.c_str());
+		GetNumFailures()++;
+	}
+};
+
+struct FIslandCoreTestRegistrar
+{
+	FIslandCoreTestRegistrar(const char* Suite, const char* Name, void (*Function)())
+	{
+		FIslandCoreTest::GetRegistry().push_back({ Suite, Name, Function });
+	}
+};
+
+#define ISLAND_TEST(Suite, Name) \
+	static void IslandTest_##Suite##_##Name(); \
+	static FIslandCoreTestRegistrar IslandTestRegistrar_##Suite##_##Name(#Suite, #Name, &IslandTest_##Suite##_##Name); \
+	static void IslandTest_##Suite##_##Name()
+
+#define ISLAND_CHECK(Expr) \
+	do { if (!(Expr)) { FIslandCoreTest::Fail(__FILE__, __LINE__, "CHECK(" #Expr ") failed"); } } while (0)
+
+#define ISLAND_CHECK_EQUAL(Actual, Expected) \
+	do \
+	{ \
+		const auto IslandActual = (Actual); \
+		const auto IslandExpected = (Expected); \
+		if (!(IslandActual == IslandExpected)) \
+		{ \
+			FIslandCoreTest::Fail(__FILE__, __LINE__, "CHECK_EQUAL(" #Actual ", " #Expected ") failed: " + \
+				std::to_string(IslandActual) + " != " + std::to_string(IslandExpected)); \
+		} \
+	} while (0)
+
+#define ISLAND_CHECK_VECTOR(Actual, Expected) \
+	do \
+	{ \
+		const FIntVector IslandActual = (Actual); \
+		const FIntVector IslandExpected = (Expected); \
+		if (IslandActual != IslandExpected) \
+		{ \
+			FIslandCoreTest::Fail(__FILE__, __LINE__, std::string("CHECK_VECTOR(" #Actual ", " #Expected ") failed: ") + \
+				*IslandActual.ToString() + " != " + *IslandExpected.ToString()); \
+		} \
+	} while (0)
+
+#define ISLAND_CHECK_NEAR(Actual, Expected, Tolerance) \
+	do \
+	{ \
+		const double IslandActual = (Actual); \
+		const double IslandExpected = (Expected); \
+		if (!(std::abs(IslandActual - IslandExpected) <= (Tolerance))) \
+		{ \
+			FIslandCoreTest::Fail(__FILE__, __LINE__, "CHECK_NEAR(" #Actual ", " #Expected ") failed: " + \
+				std::to_string(IslandActual) + " != " + std::to_string(IslandExpected)); \
+		} \
+	} while (0)
@@ -0,0 +1,37 @@
+// IslandCoreTests.cpp
+// Runs every registered test, or only the suite named on the command line. Returns the number of failed tests.
+#include "IslandCoreTest.h"
+#include <cstring>
+
+int main(int ArgC, char** ArgV)
+{
+	const char* SuiteFilter = ArgC > 1 ? ArgV[1] : nullptr;
+
+	int32 NumRun = 0;
+	int32 NumFailed = 0;
+	for (const FIslandCoreTest& Test : FIslandCoreTest::GetRegistry())
+	{
+		if (SuiteFilter && std::strcmp(SuiteFilter, Test.Suite) != 0)
+		{
+			continue;
+		}
+
+		FIslandCoreTest::GetNumFailures() = 0;
+		const double StartTime = FPlatformTime::Seconds();
+		Test.Function();
+		const bool bPassed = FIslandCoreTest::GetNumFailures() == 0;
+
+		std::printf("[%s] %s.%s (%.1f ms)\n", bPassed ? "PASS" : "FAIL", Test.Suite, Test.Name, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+		NumRun++;
+		NumFailed += bPassed ? 0 : 1;
+	}
+
+	if (NumRun == 0)
+	{
+		std::printf("No tests matched '%s'\n", SuiteFilter ? SuiteFilter : "");
+		return 1;
+	}
+
+	std::printf("%d tests, %d failed\n", NumRun, NumFailed);
+	return NumFailed;
+}
@@ -0,0 +1,142 @@
+// TestBitGrid.cpp
+#include "IslandCoreTest.h"
+#include "VoxelIslandBitGrid.h"
+#include "VoxelOccupancyBuffer.h"
+#include "VoxelSyntheticGrids.h"
+#include <set>
+#include <thread>
+
+ISLAND_TEST(BitGrid, SetGetAcrossBricks)
+{
+	// Odd-sized box with a negative origin, so bricks are partial on every axis
+	FVoxelIslandBitGrid Grid(FIntVector(-5, -3, -9), FIntVector(13, 4, 2));
+	ISLAND_CHECK_EQUAL(Grid.CountSet(), 0);
+
+	FVoxelSyntheticRandom Random(1);
+	std::set<std::tuple<int32, int32, int32>> Expected;
+	for (int32 Index = 0; Index < 300; Index++)
+	{
+		const FIntVector Pos(Random.Range(-5, 13), Random.Range(-3, 4), Random.Range(-9, 2));
+		const bool bWasSet = Grid.TestAndSet(Pos);
+		ISLAND_CHECK_EQUAL(bWasSet, !Expected.insert({ Pos.X, Pos.Y, Pos.Z }).second);
+	}
+
+	ISLAND_CHECK_EQUAL(Grid.CountSet(), int64(Expected.size()));
+	for (int32 Z = -9; Z <= 2; Z++)
+	{
+		for (int32 Y = -3; Y <= 4; Y++)
+		{
+			for (int32 X = -5; X <= 13; X++)
+			{
+				ISLAND_CHECK_EQUAL(Grid.Get(FIntVector(X, Y, Z)), Expected.count({ X, Y, Z }) != 0);
+			}
+		}
+	}
+
+	ISLAND_CHECK(Grid.Contains(FIntVector(-5, -3, -9)));
+	ISLAND_CHECK(Grid.Contains(FIntVector(13, 4, 2)));
+	ISLAND_CHECK(!Grid.Contains(FIntVector(14, 0, 0)));
+	ISLAND_CHECK(!Grid.Contains(FIntVector(0, -4, 0)));
+
+	Grid.Reset();
+	ISLAND_CHECK_EQUAL(Grid.CountSet(), 0);
+}
+
+ISLAND_TEST(BitGrid, SetAllLeavesPaddingClear)
+{
+	// Partial bricks: padding bits must stay clear so CountSet can count whole words
+	FVoxelIslandBitGrid Partial(FIntVector(0, 0, 0), FIntVector(9, 4, 10));
+	Partial.SetAll();
+	ISLAND_CHECK_EQUAL(Partial.CountSet(), int64(10 * 5 * 11));
+
+	FVoxelIslandBitGrid Aligned(FIntVector(-8, -8, -8), FIntVector(7, 7, 15));
+	Aligned.SetAll();
+	ISLAND_CHECK_EQUAL(Aligned.CountSet(), int64(16 * 16 * 24));
+}
+
+ISLAND_TEST(BitGrid, AtomicTestAndSetClaimsOnce)
+{
+	FVoxelIslandBitGrid Grid(FIntVector(0), FIntVector(31));
+
+	// Every thread tries to claim every voxel; each voxel must be claimed exactly once overall
+	std::atomic<int64> NumClaimed(0);
+	std::vector<std::thread> Threads;
+	for (int32 Thread = 0; Thread < 4; Thread++)
+	{
+		Threads.emplace_back([&]()
+		{
+			for (int32 Index = 0; Index < 32 * 32 * 32; Index++)
+			{
+				if (!Grid.AtomicTestAndSet(FIntVector(Index & 31, (Index >> 5) & 31, Index >> 10)))
+				{
+					NumClaimed++;
+				}
+			}
+		});
+	}
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+
+	ISLAND_CHECK_EQUAL(NumClaimed.load(), int64(32 * 32 * 32));
+	ISLAND_CHECK_EQUAL(Grid.CountSet(), int64(32 * 32 * 32));
+}
+
+ISLAND_TEST(OccupancyBuffer, ReadMatchesData)
+{
+	FVoxelData Data;
+	FVoxelSyntheticRandom Random(2);
+	for (int32 Index = 0; Index < 2000; Index++)
+	{
+		Data.SetSolid(FIntVector(Random.Range(-20, 20), Random.Range(-20, 20), Random.Range(-20, 20)), true);
+	}
+
+	const FIntVector Min(-17, -9, -20);
+	const FIntVector Max(19, 12, 3);
+	FVoxelOccupancyBuffer Buffer;
+	Buffer.Read(Data, Min, Max, EVoxelOccupancyFields::Values);
+	ISLAND_CHECK_EQUAL(Data.GetNumBulkQueries(), 1);
+	ISLAND_CHECK_VECTOR(Buffer.GetMin(), Min);
+	ISLAND_CHECK_VECTOR(Buffer.GetMax(), Max);
+
+	int64 NumSolid = 0;
+	for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+		{
+			for (int32 X = Min.X; X <= Max.X; X++)
+			{
+				const FIntVector Pos(X, Y, Z);
+				const bool bSolid = Data.IsSolid(Pos);
+				NumSolid += bSolid;
+				ISLAND_CHECK_EQUAL(Buffer.IsSolid(Pos), bSolid);
+				ISLAND_CHECK_EQUAL(Buffer.GetValue(Pos).IsEmpty(), !bSolid);
+			}
+		}
+	}
+	ISLAND_CHECK_EQUAL(Buffer.CountSolid(), NumSolid);
+}
+
+ISLAND_TEST(OccupancyBuffer, MaterialsAndReuse)
+{
+	FVoxelData Data;
+	Data.SetSolid(FIntVector(1, 2, 3), true);
+	Data.SetMaterial(FIntVector(1, 2, 3), FVoxelMaterial{ 42 });
+
+	FVoxelOccupancyBuffer Buffer;
+	Buffer.Read(Data, FIntVector(0), FIntVector(7), EVoxelOccupancyFields::Materials);
+	ISLAND_CHECK_EQUAL(Buffer.GetMaterial(FIntVector(1, 2, 3)).Color, 42u);
+	ISLAND_CHECK_EQUAL(Buffer.GetMaterial(FIntVector(0, 0, 0)).Color, 0u);
+	ISLAND_CHECK_EQUAL(Buffer.Values.Num(), 0);
+
+	// A smaller read into the same buffer keeps its allocation
+	const int64 AllocatedSize = Buffer.Materials.GetAllocatedSize();
+	Buffer.Read(Data, FIntVector(0), FIntVector(3), EVoxelOccupancyFields::Materials);
+	ISLAND_CHECK_EQUAL(Buffer.Materials.GetAllocatedSize(), AllocatedSize);
+	ISLAND_CHECK_EQUAL(Buffer.CountSolid(), 1);
+
+	Buffer.Fill(FIntVector(0), FIntVector(15), true);
+	ISLAND_CHECK_EQUAL(Buffer.CountSolid(), int64(16 * 16 * 16));
+	ISLAND_CHECK_EQUAL(Buffer.Materials.Num(), 0);
+}
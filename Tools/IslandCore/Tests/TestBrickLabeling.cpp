@@ -0,0 +1,83 @@
+// TestBrickLabeling.cpp
+#include "IslandCoreTest.h"
+#include "VoxelBrickLabeling.h"
+#include "VoxelGroundAnchorIndex.h"
+
+ISLAND_TEST(BrickLabeling, SeparatesComponentsAcrossBricks)
+{
+	FVoxelIslandBitGrid Grid(FIntVector(-4, -4, -2), FIntVector(40, 40, 40));
+
+	// Grounded slab
+	for (int32 Y = -4; Y <= 40; Y++)
+	{
+		for (int32 X = -4; X <= 40; X++)
+		{
+			Grid.Set(FIntVector(X, Y, 0));
+		}
+	}
+
+	// Floating staircase winding through many bricks, one face step at a time: must come out as one component
+	FIntVector Step(5, 5, 10);
+	Grid.Set(Step);
+	for (int32 Index = 0; Index < 60; Index++)
+	{
+		Step[Index % 3]++;
+		Grid.Set(Step);
+	}
+
+	// Two voxels touching only at a corner are separate 6-connected components
+	Grid.Set(FIntVector(30, 30, 30));
+	Grid.Set(FIntVector(31, 31, 31));
+
+	FVoxelBrickLabeling Labeling;
+	Labeling.Label(Grid);
+
+	const int32 SlabRoot = Labeling.FindComponentAt(FIntVector(0, 0, 0));
+	const int32 StairRoot = Labeling.FindComponentAt(FIntVector(5, 5, 10));
+	const int32 StairEndRoot = Labeling.FindComponentAt(FIntVector(25, 25, 30));
+	ISLAND_CHECK(SlabRoot != INDEX_NONE);
+	ISLAND_CHECK(StairRoot != INDEX_NONE);
+	ISLAND_CHECK_EQUAL(StairRoot, StairEndRoot);
+	ISLAND_CHECK(StairRoot != SlabRoot);
+	ISLAND_CHECK(Labeling.FindComponentAt(FIntVector(30, 30, 30)) != Labeling.FindComponentAt(FIntVector(31, 31, 31)));
+	ISLAND_CHECK_EQUAL(Labeling.FindComponentAt(FIntVector(1, 1, 1)), INDEX_NONE);
+
+	ISLAND_CHECK(Labeling.IsRootGrounded(SlabRoot));
+	ISLAND_CHECK(!Labeling.IsRootGrounded(StairRoot));
+	ISLAND_CHECK_EQUAL(Labeling.GetRootVoxelCount(SlabRoot), int64(45 * 45));
+
+	ISLAND_CHECK_EQUAL(Labeling.GetRootVoxelCount(StairRoot), int64(61));
+
+	TArray<FIntVector> StairVoxels;
+	Labeling.GatherVoxels(StairRoot, StairVoxels);
+	ISLAND_CHECK_EQUAL(StairVoxels.Num(), 61);
+	ISLAND_CHECK(StairVoxels.Contains(FIntVector(15, 14, 19)));
+}
+
+ISLAND_TEST(BrickLabeling, GridEdgeAndAnchorsGround)
+{
+	FVoxelIslandBitGrid Grid(FIntVector(0, 0, 5), FIntVector(20, 20, 30));
+
+	// Touches the +X edge of the grid: nothing is known past it, so it counts as grounded
+	for (int32 X = 15; X <= 20; X++)
+	{
+		Grid.Set(FIntVector(X, 3, 10));
+	}
+
+	// Fully inside, floating unless an anchor box covers it
+	for (int32 X = 2; X <= 6; X++)
+	{
+		Grid.Set(FIntVector(X, 10, 20));
+	}
+
+	FVoxelBrickLabeling Labeling;
+	Labeling.Label(Grid);
+	ISLAND_CHECK(Labeling.IsRootGrounded(Labeling.FindComponentAt(FIntVector(15, 3, 10))));
+	ISLAND_CHECK(!Labeling.IsRootGrounded(Labeling.FindComponentAt(FIntVector(2, 10, 20))));
+
+	FVoxelGroundAnchorIndex Anchors;
+	Anchors.SetGroundLevel(-1000);
+	Anchors.AddAnchorBox(FIntVector(6, 10, 20), FIntVector(6, 10, 20));
+	Labeling.Label(Grid, &Anchors);
+	ISLAND_CHECK(Labeling.IsRootGrounded(Labeling.FindComponentAt(FIntVector(2, 10, 20))));
+}
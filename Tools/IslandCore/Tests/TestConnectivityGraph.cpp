@@ -0,0 +1,116 @@
+// TestConnectivityGraph.cpp
+#include "IslandCoreTest.h"
+#include "VoxelConnectivityGraph.h"
+#include "VoxelIslandDetection.h"
+#include "VoxelSyntheticGrids.h"
+
+ISLAND_TEST(ConnectivityGraph, SeveredTowerMatchesFlood)
+{
+	FVoxelData Data;
+	FVoxelSyntheticGrids::AddGround(Data, 40, 4);
+	FVoxelSyntheticGrids::AddTower(Data, 0, 0, 5, 40);
+
+	FVoxelIslandEditShape Shape;
+	Shape.AddSphere(FIntVector(2, 2, 10), 4);
+	FIntVector Min, Max;
+	Shape.GetBounds(1, Min, Max);
+
+	const FVoxelIslandDetectionSettings Settings;
+	FVoxelConnectivityGraph Graph;
+	ISLAND_CHECK_EQUAL(Graph.FindSeveredIslands(Data, Min, Max, Settings).Num(), 0);
+	ISLAND_CHECK(Graph.GetNumCachedClusters() > 0);
+
+	FVoxelSyntheticGrids::Carve(Data, Shape);
+	Graph.Invalidate(Min, Max);
+	const TArray<FVoxelIsland> Severed = Graph.FindSeveredIslands(Data, Min, Max, Settings);
+
+	FIntVector SearchMin, SearchMax;
+	Shape.GetBounds(8, SearchMin, SearchMax);
+	SearchMin.Z = -4;
+	SearchMax.Z = 50;
+	ISLAND_CHECK_EQUAL(Severed.Num(), 1);
+	ISLAND_CHECK(FVoxelSyntheticGrids::Canonicalize(Severed) == FVoxelSyntheticGrids::Canonicalize(FVoxelIslandDetector::DetectIslands(Data, SearchMin, SearchMax, Shape, Settings)));
+
+	FIntVector ClusterMin, ClusterMax;
+	Graph.GetLastQueryClusters(ClusterMin, ClusterMax);
+	ISLAND_CHECK(ClusterMax.Z >= FVoxelConnectivityGraph::GetClusterCoord(FIntVector(0, 0, 40)).Z);
+}
+
+ISLAND_TEST(ConnectivityGraph, WeakClusters)
+{
+	FVoxelData Data;
+	Data.SetBox(FIntVector(-64, -64, -31), FIntVector(95, 63, 0), true);
+
+	// Bulky hill, and two towers joined by a beam on top
+	Data.SetBox(FIntVector(-60, -30, 1), FIntVector(-21, 29, 20), true);
+	Data.SetBox(FIntVector(30, 0, 1), FIntVector(33, 3, 40), true);
+	Data.SetBox(FIntVector(70, 0, 1), FIntVector(73, 3, 40), true);
+	Data.SetBox(FIntVector(30, 0, 41), FIntVector(73, 3, 43), true);
+
+	FVoxelConnectivityGraph Graph;
+	TSet<FIntVector> Weak;
+	Graph.FindWeakClusters(Data, FIntVector(-4, -4, -2), FIntVector(5, 3, 3), FVoxelIslandDetectionSettings(), Weak);
+
+	auto IsWeak = [&](const FIntVector& Voxel)
+	{
+		return Weak.Contains(FVoxelConnectivityGraph::GetClusterCoord(Voxel));
+	};
+	ISLAND_CHECK(!IsWeak(FIntVector(-40, 0, 10)));
+	ISLAND_CHECK(!IsWeak(FIntVector(0, -40, -10)));
+	ISLAND_CHECK(IsWeak(FIntVector(31, 1, 20)));
+	ISLAND_CHECK(IsWeak(FIntVector(50, 1, 42)));
+}
+
+ISLAND_TEST(ConnectivityGraph, SecondDigAfterSkippedOneIsChecked)
+{
+	// Bulky slab held up by two thick pillars - both on a cycle through the ground, so neither is weak
+	FVoxelData Data;
+	Data.SetBox(FIntVector(-64, -48, -16), FIntVector(63, 63, 15), true);
+	Data.SetBox(FIntVector(-32, 0, 16), FIntVector(-17, 15, 47), true);
+	Data.SetBox(FIntVector(16, 0, 16), FIntVector(31, 15, 47), true);
+	Data.SetBox(FIntVector(-32, 0, 48), FIntVector(31, 15, 63), true);
+
+	FVoxelIslandDetectionSettings Settings;
+	Settings.MaxIslandVoxels = 100000;
+	const FIntVector AnalysisMin(-3, -1, -1);
+	const FIntVector AnalysisMax(2, 1, 4);
+
+	FVoxelConnectivityGraph Graph;
+	FVoxelBridgeRegions Regions;
+	TSet<FIntVector> Weak;
+	Regions.BeginAnalysis();
+	Graph.FindWeakClusters(Data, AnalysisMin, AnalysisMax, Settings, Weak);
+	Regions.FinishAnalysis(AnalysisMin, AnalysisMax, MoveTemp(Weak));
+
+	FVoxelIslandEditShape DigA;
+	DigA.AddSphere(FIntVector(-24, 8, 32), 12);
+	FVoxelIslandEditShape DigB;
+	DigB.AddSphere(FIntVector(24, 8, 32), 12);
+	FIntVector DigAMin, DigAMax, DigBMin, DigBMax;
+	DigA.GetBounds(1, DigAMin, DigAMax);
+	DigB.GetBounds(1, DigBMin, DigBMax);
+
+	// Against a fresh analysis the first dig cannot sever anything
+	ISLAND_CHECK(!Regions.MaySever(DigAMin, DigAMax));
+	ISLAND_CHECK(!Regions.MaySever(DigBMin, DigBMax));
+	Regions.MarkDirty(DigAMin, DigAMax);
+	FVoxelSyntheticGrids::Carve(Data, DigA);
+
+	// The first dig made the other pillar a bridge, which the stale analysis does not know
+	ISLAND_CHECK(Regions.MaySever(DigBMin, DigBMax));
+	Regions.BeginAnalysis();
+	ISLAND_CHECK(Regions.MaySever(DigBMin, DigBMax));
+
+	Graph.Invalidate(DigAMin, DigAMax);
+	Graph.FindWeakClusters(Data, AnalysisMin, AnalysisMax, Settings, Weak);
+	Regions.FinishAnalysis(AnalysisMin, AnalysisMax, MoveTemp(Weak));
+	ISLAND_CHECK(Regions.MaySever(DigBMin, DigBMax));
+
+	// And the check it triggers finds the slab
+	Regions.MarkDirty(DigBMin, DigBMax);
+	FVoxelSyntheticGrids::Carve(Data, DigB);
+	Graph.Invalidate(DigBMin, DigBMax);
+	const TArray<FVoxelIsland> Severed = Graph.FindSeveredIslands(Data, DigBMin, DigBMax, Settings);
+	ISLAND_CHECK_EQUAL(Severed.Num(), 1);
+	ISLAND_CHECK(FVoxelSyntheticGrids::CountVoxels(Severed) >= 64 * 16 * 16);
+}
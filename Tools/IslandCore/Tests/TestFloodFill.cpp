@@ -0,0 +1,245 @@
+// TestFloodFill.cpp
+#include "IslandCoreTest.h"
+#include "VoxelIslandDetection.h"
+#include "VoxelSyntheticGrids.h"
+
+namespace
+{
+	// Ground slab with a 5x5 tower, dug through at Z = 10
+	struct FTowerCut
+	{
+		FVoxelData Data;
+		FVoxelIslandEditShape Shape;
+		FIntVector SearchMin;
+		FIntVector SearchMax;
+
+		explicit FTowerCut(int32 TowerSize = 5)
+		{
+			FVoxelSyntheticGrids::AddGround(Data, 40, 4);
+			FVoxelSyntheticGrids::AddTower(Data, 0, 0, TowerSize, 40);
+			Shape.AddSphere(FIntVector(2, 2, 10), 4);
+			FVoxelSyntheticGrids::Carve(Data, Shape);
+
+			Shape.GetBounds(8, SearchMin, SearchMax);
+			SearchMin.Z = -4;
+			SearchMax.Z = 50;
+		}
+	};
+
+	TArray<FVoxelIsland> DetectWithJob(const FVoxelData& Data, const FIntVector& SearchMin, const FIntVector& SearchMax, const FVoxelIslandEditShape& Shape, const FVoxelIslandDetectionSettings& Settings, int32& OutNumTicks)
+	{
+		FVoxelIslandDetectionJob Job(SearchMin, SearchMax, Shape, Settings);
+		while (!Job.Tick(Data, 1e-6))
+		{
+		}
+		OutNumTicks = Job.GetNumTicks();
+		return Job.ConsumeIslands();
+	}
+}
+
+ISLAND_TEST(FloodFill, TowerCutFindsTopPiece)
+{
+	const FTowerCut Scene;
+	const FVoxelIslandDetectionSettings Settings;
+	const TArray<FVoxelIsland> Islands = FVoxelIslandDetector::DetectIslands(Scene.Data, Scene.SearchMin, Scene.SearchMax, Scene.Shape, Settings);
+
+	ISLAND_CHECK_EQUAL(Islands.Num(), 1);
+	if (Islands.Num() == 1)
+	{
+		const FVoxelIsland& Island = Islands[0];
+		ISLAND_CHECK(!Island.bIsGrounded);
+		ISLAND_CHECK_EQUAL(Island.MaxBounds.Z, 40);
+		ISLAND_CHECK(Island.MinBounds.Z > 10);
+		ISLAND_CHECK(Island.Voxels.Contains(FIntVector(2, 2, 40)));
+		ISLAND_CHECK(!Island.Voxels.Contains(FIntVector(2, 2, 5)));
+	}
+	ISLAND_CHECK(FVoxelSyntheticGrids::Canonicalize(Islands) == FVoxelSyntheticGrids::FindFloatingReference(Scene.Data, Scene.SearchMin, Scene.SearchMax, Scene.Shape, Settings));
+}
+
+ISLAND_TEST(FloodFill, DigIntoGroundFindsNothing)
+{
+	FVoxelData Data;
+	FVoxelSyntheticGrids::AddGround(Data, 30, 12);
+
+	FVoxelIslandEditShape Shape;
+	Shape.AddSphere(FIntVector(0, 0, -4), 5);
+	FVoxelSyntheticGrids::Carve(Data, Shape);
+
+	FIntVector SearchMin, SearchMax;
+	Shape.GetBounds(8, SearchMin, SearchMax);
+
+	FVoxelIslandDetectionSettings Settings;
+	ISLAND_CHECK_EQUAL(FVoxelIslandDetector::DetectIslands(Data, SearchMin, SearchMax, Shape, Settings).Num(), 0);
+
+	Settings.bUseBrickLabeling = true;
+	ISLAND_CHECK_EQUAL(FVoxelIslandDetector::DetectIslands(Data, SearchMin, SearchMax, Shape, Settings).Num(), 0);
+}
+
+ISLAND_TEST(FloodFill, DetectorsMatchReferenceOnRandomStructures)
+{
+	int32 NumIslands = 0;
+	for (uint64 Seed = 1; Seed <= 6; Seed++)
+	{
+		FVoxelSyntheticRandom Random(Seed);
+		FVoxelData Data;
+		const int32 HalfExtent = 32;
+		const FVoxelIslandEditShape Shape = FVoxelSyntheticGrids::AddRandomStructures(Data, Random, HalfExtent, 6);
+		FVoxelSyntheticGrids::Carve(Data, Shape);
+
+		const FIntVector SearchMin(-HalfExtent - 1, -HalfExtent - 1, -5);
+		const FIntVector SearchMax(HalfExtent + 1, HalfExtent + 1, 45);
+
+		FVoxelIslandDetectionSettings Settings;
+		Settings.MaxFloodFillIterations = 10000000;
+		const auto Expected = FVoxelSyntheticGrids::FindFloatingReference(Data, SearchMin, SearchMax, Shape, Settings);
+		NumIslands += int32(Expected.size());
+
+		FVoxelIslandScratch Scratch;
+		const TArray<FVoxelIsland> Flood = FVoxelIslandDetector::DetectIslands(Data, SearchMin, SearchMax, Shape, Settings, &Scratch);
+		ISLAND_CHECK(FVoxelSyntheticGrids::Canonicalize(Flood) == Expected);
+
+		FVoxelIslandBitGrid Snapshot;
+		FVoxelIslandDetector::SnapshotOccupancy(Data, SearchMin, SearchMax, Snapshot);
+		ISLAND_CHECK(FVoxelSyntheticGrids::Canonicalize(FVoxelIslandDetector::DetectIslandsInSnapshot(Snapshot, Shape, Settings, &Scratch)) == Expected);
+
+		FVoxelIslandDetectionSettings ParallelSettings = Settings;
+		ParallelSettings.ParallelFloodMinVoxels = 1;
+		ISLAND_CHECK(FVoxelSyntheticGrids::Canonicalize(FVoxelIslandDetector::DetectIslandsInSnapshot(Snapshot, Shape, ParallelSettings, &Scratch)) == Expected);
+
+		FVoxelIslandDetectionSettings LabelingSettings = Settings;
+		LabelingSettings.bUseBrickLabeling = true;
+		ISLAND_CHECK(FVoxelSyntheticGrids::Canonicalize(FVoxelIslandDetector::DetectIslands(Data, SearchMin, SearchMax, Shape, LabelingSettings, &Scratch)) == Expected);
+	}
+
+	// The scenes must actually sever something for the comparison to mean anything
+	ISLAND_CHECK(NumIslands > 0);
+}
+
+ISLAND_TEST(FloodFill, ParallelMatchesSerialOnLargeStructure)
+{
+	// Wide block on a thin tower, cut below the block: one piece of more than 100k voxels falls
+	FVoxelData Data;
+	FVoxelSyntheticGrids::AddGround(Data, 40, 4);
+	FVoxelSyntheticGrids::AddTower(Data, 0, 0, 4, 20);
+	Data.SetBox(FIntVector(-32, -32, 21), FIntVector(31, 31, 52), true);
+
+	FVoxelIslandEditShape Shape;
+	Shape.AddSphere(FIntVector(1, 1, 12), 3);
+	FVoxelSyntheticGrids::Carve(Data, Shape);
+
+	const FIntVector SearchMin(-41, -41, -5);
+	const FIntVector SearchMax(41, 41, 54);
+	FVoxelIslandBitGrid Snapshot;
+	FVoxelIslandDetector::SnapshotOccupancy(Data, SearchMin, SearchMax, Snapshot);
+
+	FVoxelIslandDetectionSettings SerialSettings;
+	SerialSettings.MaxFloodFillIterations = 10000000;
+	SerialSettings.MaxIslandVoxels = 1000000;
+	SerialSettings.ParallelFloodMinVoxels = 0;
+	FVoxelIslandDetectionSettings ParallelSettings = SerialSettings;
+	ParallelSettings.ParallelFloodMinVoxels = 100000;
+
+	FVoxelIslandScratch Scratch;
+	const TArray<FVoxelIsland> Serial = FVoxelIslandDetector::DetectIslandsInSnapshot(Snapshot, Shape, SerialSettings, &Scratch);
+	const TArray<FVoxelIsland> Parallel = FVoxelIslandDetector::DetectIslandsInSnapshot(Snapshot, Shape, ParallelSettings, &Scratch);
+	ISLAND_CHECK_EQUAL(Serial.Num(), 1);
+	ISLAND_CHECK(FVoxelSyntheticGrids::CountVoxels(Serial) > 100000);
+	ISLAND_CHECK(FVoxelSyntheticGrids::Canonicalize(Parallel) == FVoxelSyntheticGrids::Canonicalize(Serial));
+	ISLAND_CHECK(FVoxelSyntheticGrids::Canonicalize(Serial) == FVoxelSyntheticGrids::FindFloatingReference(Data, SearchMin, SearchMax, Shape, SerialSettings));
+
+	// A budget that runs out inside the piece leaves it in place on both paths
+	SerialSettings.MaxFloodFillIterations = 50000;
+	ParallelSettings.MaxFloodFillIterations = 50000;
+	ISLAND_CHECK_EQUAL(FVoxelIslandDetector::DetectIslandsInSnapshot(Snapshot, Shape, SerialSettings, &Scratch).Num(), 0);
+	ISLAND_CHECK_EQUAL(FVoxelIslandDetector::DetectIslandsInSnapshot(Snapshot, Shape, ParallelSettings, &Scratch).Num(), 0);
+}
+
+ISLAND_TEST(FloodFill, ConnectivityModes)
+{
+	FVoxelData Data;
+	FVoxelSyntheticGrids::AddGround(Data, 20, 4);
+	FVoxelSyntheticGrids::AddTower(Data, 0, 0, 2, 10);
+
+	// Cube sharing only an edge with the pillar, and a cube above sharing only a corner with it
+	Data.SetBox(FIntVector(2, 2, 8), FIntVector(4, 4, 10), true);
+	Data.SetBox(FIntVector(-3, -3, 11), FIntVector(-1, -1, 13), true);
+
+	FVoxelIslandEditShape EdgeShape;
+	EdgeShape.AddSphere(FIntVector(3, 3, 13), 2);
+	FVoxelIslandEditShape CornerShape;
+	CornerShape.AddSphere(FIntVector(-2, -2, 16), 2);
+
+	auto CountIslands = [&](const FVoxelIslandEditShape& Shape, EVoxelConnectivity Connectivity)
+	{
+		FIntVector SearchMin, SearchMax;
+		Shape.GetBounds(8, SearchMin, SearchMax);
+		SearchMin.Z = -4;
+
+		FVoxelIslandDetectionSettings Settings;
+		Settings.Connectivity = Connectivity;
+		const TArray<FVoxelIsland> Islands = FVoxelIslandDetector::DetectIslands(Data, SearchMin, SearchMax, Shape, Settings);
+		ISLAND_CHECK(FVoxelSyntheticGrids::Canonicalize(Islands) == FVoxelSyntheticGrids::FindFloatingReference(Data, SearchMin, SearchMax, Shape, Settings));
+		return Islands.Num();
+	};
+
+	ISLAND_CHECK_EQUAL(CountIslands(EdgeShape, EVoxelConnectivity::Faces6), 1);
+	ISLAND_CHECK_EQUAL(CountIslands(EdgeShape, EVoxelConnectivity::Edges18), 0);
+	ISLAND_CHECK_EQUAL(CountIslands(CornerShape, EVoxelConnectivity::Edges18), 1);
+	ISLAND_CHECK_EQUAL(CountIslands(CornerShape, EVoxelConnectivity::Corners26), 0);
+}
+
+ISLAND_TEST(FloodFill, TimeSlicedJobMatchesDetectIslands)
+{
+	FVoxelSyntheticRandom Random(11);
+	FVoxelData Data;
+	const FVoxelIslandEditShape Shape = FVoxelSyntheticGrids::AddRandomStructures(Data, Random, 24, 5);
+	FVoxelSyntheticGrids::Carve(Data, Shape);
+
+	const FIntVector SearchMin(-25, -25, -5);
+	const FIntVector SearchMax(25, 25, 45);
+	FVoxelIslandDetectionSettings Settings;
+	Settings.MaxFloodFillIterations = 10000000;
+
+	int32 NumTicks = 0;
+	const TArray<FVoxelIsland> Sliced = DetectWithJob(Data, SearchMin, SearchMax, Shape, Settings, NumTicks);
+	const TArray<FVoxelIsland> Direct = FVoxelIslandDetector::DetectIslands(Data, SearchMin, SearchMax, Shape, Settings);
+	ISLAND_CHECK(NumTicks > 1);
+	ISLAND_CHECK(FVoxelSyntheticGrids::Canonicalize(Sliced) == FVoxelSyntheticGrids::Canonicalize(Direct));
+}
+
+ISLAND_TEST(FloodFill, BatchMatchesSeparateDetections)
+{
+	const FTowerCut Wide(5);
+	const FTowerCut Narrow(3);
+	const FVoxelIslandDetectionSettings Settings;
+
+	TArray<FVoxelIslandBatchRequest> Requests;
+	Requests.Add({ &Wide.Data, Wide.SearchMin, Wide.SearchMax, Wide.Shape, Settings });
+	Requests.Add({ &Narrow.Data, Narrow.SearchMin, Narrow.SearchMax, Narrow.Shape, Settings });
+	const TArray<TArray<FVoxelIsland>> Batch = FVoxelIslandDetector::DetectIslandsBatch(Requests);
+
+	ISLAND_CHECK_EQUAL(Batch.Num(), 2);
+	ISLAND_CHECK(FVoxelSyntheticGrids::Canonicalize(Batch[0]) == FVoxelSyntheticGrids::Canonicalize(FVoxelIslandDetector::DetectIslands(Wide.Data, Wide.SearchMin, Wide.SearchMax, Wide.Shape, Settings)));
+	ISLAND_CHECK(FVoxelSyntheticGrids::Canonicalize(Batch[1]) == FVoxelSyntheticGrids::Canonicalize(FVoxelIslandDetector::DetectIslands(Narrow.Data, Narrow.SearchMin, Narrow.SearchMax, Narrow.Shape, Settings)));
+	ISLAND_CHECK(FVoxelSyntheticGrids::CountVoxels(Batch[0]) > FVoxelSyntheticGrids::CountVoxels(Batch[1]));
+}
+
+ISLAND_TEST(FloodFill, CountSolidVoxelsSeesLaterEdits)
+{
+	FTowerCut Scene;
+	const TArray<FVoxelIsland> Islands = FVoxelIslandDetector::DetectIslands(Scene.Data, Scene.SearchMin, Scene.SearchMax, Scene.Shape, FVoxelIslandDetectionSettings());
+	ISLAND_CHECK_EQUAL(Islands.Num(), 1);
+	if (Islands.Num() != 1)
+	{
+		return;
+	}
+
+	Scene.Data.ResetQueryCounts();
+	ISLAND_CHECK_EQUAL(FVoxelIslandDetector::CountSolidVoxels(Scene.Data, Islands[0]), Islands[0].Voxels.Num());
+	ISLAND_CHECK_EQUAL(Scene.Data.GetNumBulkQueries(), int64(1));
+	ISLAND_CHECK_EQUAL(Scene.Data.GetNumPointQueries(), int64(0));
+
+	// Knock the top row off
+	Scene.Data.SetBox(FIntVector(0, 0, 40), FIntVector(4, 4, 40), false);
+	ISLAND_CHECK_EQUAL(FVoxelIslandDetector::CountSolidVoxels(Scene.Data, Islands[0]), Islands[0].Voxels.Num() - 25);
+}
@@ -0,0 +1,49 @@
+// TestGroundAnchors.cpp
+#include "IslandCoreTest.h"
+#include "VoxelGroundAnchorIndex.h"
+
+ISLAND_TEST(GroundAnchors, GroundLevelHeightfieldAndBoxes)
+{
+	FVoxelGroundAnchorIndex Anchors;
+	ISLAND_CHECK(Anchors.IsGroundLevelOnly());
+	ISLAND_CHECK(Anchors.IsAnchor(FIntVector(100, -100, 0)));
+	ISLAND_CHECK(!Anchors.IsAnchor(FIntVector(0, 0, 1)));
+
+	Anchors.SetGroundLevel(-10);
+	ISLAND_CHECK(!Anchors.IsAnchor(FIntVector(0, 0, 0)));
+
+	// 2x2 cells of 4 voxels starting at (-4, -4)
+	Anchors.SetHeightfield(FIntVector(-4, -4, 0), 4, 2, 2, TArray<int32>{ 0, 5, -20, 12 });
+	ISLAND_CHECK(!Anchors.IsGroundLevelOnly());
+	ISLAND_CHECK(Anchors.IsAnchor(FIntVector(-4, -4, 0)));
+	ISLAND_CHECK(!Anchors.IsAnchor(FIntVector(-4, -4, 1)));
+	ISLAND_CHECK(Anchors.IsAnchor(FIntVector(3, -1, 5)));
+	ISLAND_CHECK(!Anchors.IsAnchor(FIntVector(3, -1, 6)));
+	ISLAND_CHECK(Anchors.IsAnchor(FIntVector(-1, 3, -10)));
+	ISLAND_CHECK(!Anchors.IsAnchor(FIntVector(-1, 3, -9)));
+	ISLAND_CHECK(Anchors.IsAnchor(FIntVector(0, 0, 12)));
+
+	// Outside the heightfield only the ground level applies
+	ISLAND_CHECK(!Anchors.IsAnchor(FIntVector(-5, 0, 0)));
+	ISLAND_CHECK(!Anchors.IsAnchor(FIntVector(4, 0, 0)));
+
+	// Box spanning several lookup cells
+	Anchors.AddAnchorBox(FIntVector(30, 30, 30), FIntVector(70, 31, 32));
+	ISLAND_CHECK_EQUAL(Anchors.GetNumAnchorBoxes(), 1);
+	ISLAND_CHECK(Anchors.IsAnchor(FIntVector(30, 30, 30)));
+	ISLAND_CHECK(Anchors.IsAnchor(FIntVector(50, 31, 31)));
+	ISLAND_CHECK(Anchors.IsAnchor(FIntVector(70, 31, 32)));
+	ISLAND_CHECK(!Anchors.IsAnchor(FIntVector(71, 31, 32)));
+	ISLAND_CHECK(!Anchors.IsAnchor(FIntVector(50, 32, 31)));
+}
+
+ISLAND_TEST(GroundAnchors, RebuildAtSameAddressGetsNewGeneration)
+{
+	TOptional<FVoxelGroundAnchorIndex> Anchors;
+	const FVoxelGroundAnchorIndex* const Address = &Anchors.Emplace();
+	const uint32 Generation = Anchors->GetGeneration();
+	Anchors.Reset();
+
+	ISLAND_CHECK(&Anchors.Emplace() == Address);
+	ISLAND_CHECK(Anchors->GetGeneration() != Generation);
+}
@@ -0,0 +1,240 @@
+// TestIslandTransfer.cpp
+#include "IslandCoreTest.h"
+#include "VoxelIsland.h"
+#include "VoxelIslandTransfer.h"
+#include "VoxelSyntheticGrids.h"
+
+namespace
+{
+	// Irregular blob with a tower on top, authored solid with a material per voxel, plus a solid box right
+	// next to it that shares chunks with the island but is not part of it
+	FVoxelIsland MakeIslandNextToStranger(FVoxelData& Data, const FIntVector& Origin, uint64 Seed)
+	{
+		FVoxelSyntheticRandom Random(Seed);
+		TArray<FIntVector> Positions;
+		for (int32 Z = 0; Z < 40; Z++)
+		{
+			const int32 Radius = Z < 12 ? 9 : 3;
+			for (int32 Y = -Radius; Y <= Radius; Y++)
+			{
+				for (int32 X = -Radius; X <= Radius; X++)
+				{
+					if (X * X + Y * Y <= Radius * Radius && Random.Range(0, 9) != 0)
+					{
+						Positions.Add(Origin + FIntVector(X, Y, Z));
+					}
+				}
+			}
+		}
+
+		for (const FIntVector& Pos : Positions)
+		{
+			Data.SetValue(Pos, FVoxelValue(int16(-100 - (Pos.X & 31))));
+			Data.SetMaterial(Pos, FVoxelMaterial{ (uint32(Pos.X) * 73856093u) ^ (uint32(Pos.Y) * 19349663u) ^ (uint32(Pos.Z) * 83492791u) });
+		}
+		Data.SetBox(Origin + FIntVector(11, -4, 0), Origin + FIntVector(14, 4, 20), true);
+
+		FVoxelIsland Island;
+		Island.Voxels.Assign(Positions);
+		Island.UpdateStats();
+		return Island;
+	}
+
+	int64 CountSolid(const FVoxelData& Data, const FIntVector& Min, const FIntVector& Max)
+	{
+		int64 Count = 0;
+		for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+		{
+			for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+			{
+				for (int32 X = Min.X; X <= Max.X; X++)
+				{
+					Count += Data.IsSolid(FIntVector(X, Y, Z)) ? 1 : 0;
+				}
+			}
+		}
+		return Count;
+	}
+}
+
+ISLAND_TEST(IslandTransfer, CopiesExactlyTheIslandRebased)
+{
+	FVoxelData Source;
+	const FVoxelIsland Island = MakeIslandNextToStranger(Source, FIntVector(-37, 21, 5), 1);
+
+	FVoxelIslandTransfer Transfer;
+	Source.ResetQueryCounts();
+	Transfer.Read(Source, Island, FIntVector::ZeroValue);
+	ISLAND_CHECK_EQUAL(Transfer.GetNumVoxels(), Island.Voxels.Num());
+	ISLAND_CHECK_VECTOR(Transfer.GetDestMin(), FIntVector::ZeroValue);
+	ISLAND_CHECK_VECTOR(Transfer.GetDestMax(), Island.MaxBounds - Island.MinBounds);
+
+	// Two bulk queries per chunk, nothing per voxel
+	ISLAND_CHECK_EQUAL(Source.GetNumBulkQueries(), int64(Transfer.GetChunks().Num()) * 2);
+	ISLAND_CHECK_EQUAL(Source.GetNumPointQueries(), int64(0));
+
+	FVoxelData Destination;
+	Transfer.Write(Destination);
+	ISLAND_CHECK_EQUAL(Destination.GetNumBulkWrites(), int64(Transfer.GetChunks().Num()) * 2);
+
+	const FIntVector Offset = FIntVector::ZeroValue - Island.MinBounds;
+	int32 NumMismatches = 0;
+	for (const FIntVector Pos : Island.Voxels)
+	{
+		NumMismatches += Destination.GetValue(Pos + Offset, 0) == Source.GetValue(Pos, 0) ? 0 : 1;
+		NumMismatches += Destination.GetMaterial(Pos + Offset, 0) == Source.GetMaterial(Pos, 0) ? 0 : 1;
+	}
+	ISLAND_CHECK_EQUAL(NumMismatches, 0);
+
+	// The neighboring box shares chunks with the island but must not come along
+	ISLAND_CHECK_EQUAL(CountSolid(Destination, FIntVector(-2), Transfer.GetDestMax() + FIntVector(2)), int64(Island.Voxels.Num()));
+}
+
+ISLAND_TEST(IslandTransfer, ChunksFollowTheDestinationGrid)
+{
+	FVoxelData Source;
+	const FVoxelIsland Island = MakeIslandNextToStranger(Source, FIntVector(5, -3, 70), 2);
+
+	// Offset that is neither chunk nor brick aligned
+	FVoxelIslandTransfer Transfer;
+	Transfer.Read(Source, Island, FIntVector(3, 17, -5));
+
+	const FIntVector DestSize = Transfer.GetDestMax() - Transfer.GetDestMin() + FIntVector(1);
+	ISLAND_CHECK(Transfer.GetChunks().Num() <= (DestSize.X / 16 + 2) * (DestSize.Y / 16 + 2) * (DestSize.Z / 16 + 2));
+
+	int32 NumVoxels = 0;
+	for (const FVoxelIslandTransfer::FChunk& Chunk : Transfer.GetChunks())
+	{
+		ISLAND_CHECK_VECTOR(FIntVector(Chunk.Min.X >> 4, Chunk.Min.Y >> 4, Chunk.Min.Z >> 4), FIntVector(Chunk.Max.X >> 4, Chunk.Max.Y >> 4, Chunk.Max.Z >> 4));
+		ISLAND_CHECK(Chunk.NumVoxels > 0);
+
+		// Everything the box caught besides the island is masked out
+		for (int32 Index = 0; Index < Chunk.Values.Num(); Index++)
+		{
+			if (!Chunk.IsIslandVoxel(Index))
+			{
+				ISLAND_CHECK(Chunk.Values[Index].IsEmpty());
+				ISLAND_CHECK(Chunk.Materials[Index] == FVoxelMaterial::Default());
+			}
+		}
+		NumVoxels += Chunk.NumVoxels;
+	}
+	ISLAND_CHECK_EQUAL(NumVoxels, Island.Voxels.Num());
+}
+
+ISLAND_TEST(IslandTransfer, ForceSolidKeepsMaterialsAndLeavesOthersAlone)
+{
+	FVoxelData Source;
+	const FVoxelIsland Island = MakeIslandNextToStranger(Source, FIntVector(0), 3);
+
+	FVoxelIslandTransfer Transfer;
+	Transfer.Read(Source, Island, FIntVector(8));
+
+	// Voxels already in the destination outside the island survive the write
+	FVoxelData Destination;
+	Destination.SetBox(FIntVector(0), FIntVector(7), true);
+	Transfer.Write(Destination, true);
+
+	const FIntVector Offset = FIntVector(8) - Island.MinBounds;
+	int32 NumMismatches = 0;
+	for (const FIntVector Pos : Island.Voxels)
+	{
+		NumMismatches += Destination.GetValue(Pos + Offset, 0) == FVoxelValue::Full() ? 0 : 1;
+		NumMismatches += Destination.GetMaterial(Pos + Offset, 0) == Source.GetMaterial(Pos, 0) ? 0 : 1;
+	}
+	ISLAND_CHECK_EQUAL(NumMismatches, 0);
+	ISLAND_CHECK_EQUAL(CountSolid(Destination, FIntVector(0), FIntVector(7)), int64(8 * 8 * 8));
+}
+
+ISLAND_TEST(IslandTransfer, EmptyIsland)
+{
+	FVoxelData Source;
+	FVoxelIsland Island;
+
+	FVoxelIslandTransfer Transfer;
+	Transfer.Read(Source, Island, FIntVector::ZeroValue);
+	ISLAND_CHECK_EQUAL(Transfer.GetChunks().Num(), 0);
+
+	FVoxelData Destination;
+	Transfer.Write(Destination);
+	ISLAND_CHECK_EQUAL(Destination.GetNumChunks(), 0);
+}
+
+ISLAND_TEST(IslandTransfer, SamplingMatchesTheWrittenCopy)
+{
+	FVoxelData Source;
+	const FVoxelIsland Island = MakeIslandNextToStranger(Source, FIntVector(-20, 9, 33), 4);
+
+	FVoxelIslandTransfer Transfer;
+	Transfer.Read(Source, Island, FIntVector(2, -7, 0));
+	FVoxelData Destination;
+	Transfer.Write(Destination);
+
+	// A falling world sampling the snapshot sees exactly what a written copy holds, padding included
+	const FIntVector Min = Transfer.GetDestMin() - FIntVector(3);
+	const FIntVector Max = Transfer.GetDestMax() + FIntVector(3);
+	int32 NumMismatches = 0;
+	for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+		{
+			for (int32 X = Min.X; X <= Max.X; X++)
+			{
+				const FIntVector Pos(X, Y, Z);
+				NumMismatches += Transfer.GetValue(Pos) == Destination.GetValue(Pos, 0) ? 0 : 1;
+				NumMismatches += Transfer.GetMaterial(Pos) == Destination.GetMaterial(Pos, 0) ? 0 : 1;
+			}
+		}
+	}
+	ISLAND_CHECK_EQUAL(NumMismatches, 0);
+
+	ISLAND_CHECK(Transfer.Intersects(Transfer.GetDestMin(), Transfer.GetDestMin()));
+	ISLAND_CHECK(Transfer.Intersects(Min - FIntVector(100), Max + FIntVector(100)));
+	ISLAND_CHECK(!Transfer.Intersects(Max + FIntVector(1), Max + FIntVector(40)));
+	ISLAND_CHECK(!Transfer.Intersects(Min - FIntVector(40), Transfer.GetDestMin() - FIntVector(1)));
+}
+
+ISLAND_TEST(IslandTransfer, EraseClearsTheIslandWithBoxWrites)
+{
+	FVoxelData Data;
+	FVoxelIsland Island = MakeIslandNextToStranger(Data, FIntVector(-9, 14, 2), 5);
+
+	// A solid core of whole bricks, so both box kinds are written
+	TArray<FIntVector> Positions = Island.Voxels.ToArray();
+	for (int32 Z = 8; Z < 24; Z++)
+	{
+		for (int32 Y = 0; Y < 16; Y++)
+		{
+			for (int32 X = -16; X < 0; X++)
+			{
+				Data.SetSolid(FIntVector(X, Y, Z), true);
+				Positions.Add(FIntVector(X, Y, Z));
+			}
+		}
+	}
+	Island.Voxels.Assign(Positions);
+	Island.UpdateStats();
+
+	const int64 NumSolidBefore = CountSolid(Data, Island.MinBounds - FIntVector(8), Island.MaxBounds + FIntVector(8));
+
+	Data.ResetQueryCounts();
+	FIntVector DirtyMin, DirtyMax;
+	const int32 NumBoxes = FVoxelIslandTransfer::Erase(Data, Island, DirtyMin, DirtyMax);
+	ISLAND_CHECK(NumBoxes > 0);
+	ISLAND_CHECK(NumBoxes < Island.Voxels.NumBricks());
+	ISLAND_CHECK_EQUAL(Data.GetNumBulkWrites(), int64(NumBoxes) * 2);
+	ISLAND_CHECK_EQUAL(Data.GetNumPointQueries(), int64(0));
+	ISLAND_CHECK_VECTOR(DirtyMin, Island.MinBounds);
+	ISLAND_CHECK_VECTOR(DirtyMax, Island.MaxBounds);
+
+	int32 NumLeft = 0;
+	for (const FIntVector Pos : Island.Voxels)
+	{
+		NumLeft += Data.IsSolid(Pos) ? 1 : 0;
+		NumLeft += Data.GetMaterial(Pos, 0) == FVoxelMaterial::Default() ? 0 : 1;
+	}
+	ISLAND_CHECK_EQUAL(NumLeft, 0);
+
+	// Only the island went; the neighboring box sharing its bricks stays
+	ISLAND_CHECK_EQUAL(CountSolid(Data, Island.MinBounds - FIntVector(8), Island.MaxBounds + FIntVector(8)), NumSolidBefore - Island.Voxels.Num());
+}
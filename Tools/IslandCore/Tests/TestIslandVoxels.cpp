@@ -0,0 +1,180 @@
+// TestIslandVoxels.cpp
+#include "IslandCoreTest.h"
+#include "VoxelIslandVoxels.h"
+#include "VoxelSyntheticGrids.h"
+#include <set>
+
+ISLAND_TEST(IslandVoxels, AssignDeduplicatesAndIterates)
+{
+	FVoxelSyntheticRandom Random(3);
+	TArray<FIntVector> Positions;
+	std::set<std::tuple<int32, int32, int32>> Expected;
+	for (int32 Index = 0; Index < 3000; Index++)
+	{
+		const FIntVector Pos(Random.Range(-30, 30), Random.Range(-10, 10), Random.Range(-5, 40));
+		Positions.Add(Pos);
+		Expected.insert({ Pos.X, Pos.Y, Pos.Z });
+	}
+
+	const FVoxelIslandVoxels Voxels(Positions);
+	ISLAND_CHECK_EQUAL(Voxels.Num(), int32(Expected.size()));
+
+	int32 NumVisited = 0;
+	FIntVector LastBrick = FIntVector(MIN_int32);
+	for (const FIntVector Pos : Voxels)
+	{
+		ISLAND_CHECK(Expected.count({ Pos.X, Pos.Y, Pos.Z }) != 0);
+		ISLAND_CHECK(Voxels.Contains(Pos));
+
+		// Bricks come out sorted Z, then Y, then X
+		const FIntVector Brick(Pos.X >> 3, Pos.Y >> 3, Pos.Z >> 3);
+		if (Brick != LastBrick && LastBrick.X != MIN_int32)
+		{
+			ISLAND_CHECK(std::make_tuple(LastBrick.Z, LastBrick.Y, LastBrick.X) < std::make_tuple(Brick.Z, Brick.Y, Brick.X));
+		}
+		LastBrick = Brick;
+		NumVisited++;
+	}
+	ISLAND_CHECK_EQUAL(NumVisited, Voxels.Num());
+	ISLAND_CHECK_EQUAL(Voxels.ToArray().Num(), Voxels.Num());
+
+	ISLAND_CHECK(!Voxels.Contains(FIntVector(31, 0, 0)));
+	ISLAND_CHECK(!Voxels.Contains(FIntVector(0, 0, 41)));
+}
+
+ISLAND_TEST(IslandVoxels, StatsMatchBruteForce)
+{
+	FVoxelSyntheticRandom Random(4);
+	TArray<FIntVector> Positions;
+	for (int32 Index = 0; Index < 5000; Index++)
+	{
+		// Skewed blob so the products of inertia are not zero
+		const int32 X = Random.Range(-12, 20);
+		Positions.Add(FIntVector(X, X / 2 + Random.Range(-3, 3), Random.Range(100, 110) + X / 3));
+	}
+
+	const FVoxelIslandVoxels Voxels(Positions);
+	const FVoxelIslandStats Stats = Voxels.ComputeStats();
+
+	FIntVector Min(MAX_int32);
+	FIntVector Max(MIN_int32);
+	FVector Sum = FVector::ZeroVector;
+	for (const FIntVector Pos : Voxels)
+	{
+		Min = FIntVector(FMath::Min(Min.X, Pos.X), FMath::Min(Min.Y, Pos.Y), FMath::Min(Min.Z, Pos.Z));
+		Max = FIntVector(FMath::Max(Max.X, Pos.X), FMath::Max(Max.Y, Pos.Y), FMath::Max(Max.Z, Pos.Z));
+		Sum += FVector(Pos);
+	}
+	const double Count = Voxels.Num();
+	const FVector Centroid = Sum / Count;
+
+	// Unit cubes of unit mass: point-mass inertia plus 1/6 per cube on the diagonal
+	FVector Diagonal(Count / 6.0);
+	FVector Products = FVector::ZeroVector;
+	for (const FIntVector Pos : Voxels)
+	{
+		const FVector D = FVector(Pos) - Centroid;
+		Diagonal += FVector(D.Y * D.Y + D.Z * D.Z, D.X * D.X + D.Z * D.Z, D.X * D.X + D.Y * D.Y);
+		Products += FVector(-D.X * D.Y, -D.X * D.Z, -D.Y * D.Z);
+	}
+
+	ISLAND_CHECK_EQUAL(Stats.NumVoxels, Voxels.Num());
+	ISLAND_CHECK_VECTOR(Stats.Min, Min);
+	ISLAND_CHECK_VECTOR(Stats.Max, Max);
+	ISLAND_CHECK_NEAR(Stats.Centroid.X, Centroid.X, 1e-6);
+	ISLAND_CHECK_NEAR(Stats.Centroid.Y, Centroid.Y, 1e-6);
+	ISLAND_CHECK_NEAR(Stats.Centroid.Z, Centroid.Z, 1e-6);
+	ISLAND_CHECK_NEAR(Stats.InertiaDiagonal.X, Diagonal.X, Diagonal.X * 1e-9);
+	ISLAND_CHECK_NEAR(Stats.InertiaDiagonal.Y, Diagonal.Y, Diagonal.Y * 1e-9);
+	ISLAND_CHECK_NEAR(Stats.InertiaDiagonal.Z, Diagonal.Z, Diagonal.Z * 1e-9);
+	ISLAND_CHECK_NEAR(Stats.InertiaProducts.X, Products.X, Diagonal.X * 1e-9);
+	ISLAND_CHECK_NEAR(Stats.InertiaProducts.Y, Products.Y, Diagonal.X * 1e-9);
+	ISLAND_CHECK_NEAR(Stats.InertiaProducts.Z, Products.Z, Diagonal.X * 1e-9);
+}
+
+ISLAND_TEST(IslandVoxels, EmptySetHasZeroStats)
+{
+	const FVoxelIslandVoxels Voxels;
+	const FVoxelIslandStats Stats = Voxels.ComputeStats();
+	ISLAND_CHECK_EQUAL(Stats.NumVoxels, 0);
+	ISLAND_CHECK_VECTOR(Stats.Min, FIntVector::ZeroValue);
+	ISLAND_CHECK(Stats.Centroid == FVector::ZeroVector);
+	ISLAND_CHECK(!(Voxels.begin() != Voxels.end()));
+}
+
+ISLAND_TEST(IslandVoxels, BoxesCoverTheSetExactly)
+{
+	// Solid slab spanning several bricks, off the brick grid, plus scattered voxels around it
+	FVoxelSyntheticRandom Random(5);
+	TArray<FIntVector> Positions;
+	for (int32 Z = -3; Z < 21; Z++)
+	{
+		for (int32 Y = 4; Y < 30; Y++)
+		{
+			for (int32 X = -13; X < 40; X++)
+			{
+				Positions.Add(FIntVector(X, Y, Z));
+			}
+		}
+	}
+	for (int32 Index = 0; Index < 500; Index++)
+	{
+		Positions.Add(FIntVector(Random.Range(-40, 60), Random.Range(-20, 50), Random.Range(-10, 30)));
+	}
+	const FVoxelIslandVoxels Voxels(Positions);
+
+	std::set<std::tuple<int32, int32, int32>> Covered;
+	int32 NumFullBoxes = 0;
+	int32 NumBoxes = 0;
+	Voxels.ForEachBox([&](const FIntVector& Min, const FIntVector& Max, const uint64* Words)
+	{
+		NumBoxes++;
+		NumFullBoxes += Words ? 0 : 1;
+		for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+		{
+			for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+			{
+				for (int32 X = Min.X; X <= Max.X; X++)
+				{
+					const bool bInBox = !Words || ((Words[Z & 7] >> ((Y & 7) * 8 + (X & 7))) & 1);
+					if (bInBox)
+					{
+						ISLAND_CHECK(Voxels.Contains(FIntVector(X, Y, Z)));
+						ISLAND_CHECK(Covered.insert({ X, Y, Z }).second);
+					}
+				}
+			}
+		}
+	});
+	ISLAND_CHECK_EQUAL(int32(Covered.size()), Voxels.Num());
+
+	// The slab's inner bricks merge into runs along X
+	ISLAND_CHECK(NumFullBoxes > 0);
+	ISLAND_CHECK(NumBoxes < Voxels.NumBricks());
+}
+
+ISLAND_TEST(IslandVoxels, AlignedCubeIsOneBoxPerBrickRow)
+{
+	TArray<FIntVector> Positions;
+	for (int32 Z = 0; Z < 32; Z++)
+	{
+		for (int32 Y = -16; Y < 16; Y++)
+		{
+			for (int32 X = 8; X < 40; X++)
+			{
+				Positions.Add(FIntVector(X, Y, Z));
+			}
+		}
+	}
+	const FVoxelIslandVoxels Voxels(Positions);
+
+	int32 NumBoxes = 0;
+	Voxels.ForEachBox([&](const FIntVector& Min, const FIntVector& Max, const uint64* Words)
+	{
+		ISLAND_CHECK(Words == nullptr);
+		ISLAND_CHECK_EQUAL(Min.X, 8);
+		ISLAND_CHECK_EQUAL(Max.X, 39);
+		NumBoxes++;
+	});
+	ISLAND_CHECK_EQUAL(NumBoxes, 4 * 4);
+}
@@ -0,0 +1,114 @@
+// TestOccupancyPyramid.cpp
+#include "IslandCoreTest.h"
+#include "VoxelConnectivityGraph.h"
+#include "VoxelIslandDetection.h"
+#include "VoxelOccupancyPyramid.h"
+#include "VoxelSyntheticGrids.h"
+
+ISLAND_TEST(OccupancyPyramid, ClassifyCells)
+{
+	FVoxelIslandBitGrid Cell(FIntVector(0), FIntVector(15));
+	ISLAND_CHECK(FVoxelOccupancyPyramid::Classify(Cell) == EVoxelOccupancyState::Empty);
+
+	Cell.Set(FIntVector(7, 3, 12));
+	ISLAND_CHECK(FVoxelOccupancyPyramid::Classify(Cell) == EVoxelOccupancyState::Mixed);
+
+	Cell.SetAll();
+	ISLAND_CHECK(FVoxelOccupancyPyramid::Classify(Cell) == EVoxelOccupancyState::Full);
+}
+
+ISLAND_TEST(OccupancyPyramid, ParentsNeedAllChildren)
+{
+	FVoxelOccupancyPyramid Pyramid;
+	for (int32 Child = 0; Child < 7; Child++)
+	{
+		Pyramid.SetCellState(FIntVector(Child & 1, (Child >> 1) & 1, Child >> 2), EVoxelOccupancyState::Empty);
+	}
+	ISLAND_CHECK(Pyramid.GetState(1, FIntVector(0)) == EVoxelOccupancyState::Unknown);
+
+	Pyramid.SetCellState(FIntVector(1, 1, 1), EVoxelOccupancyState::Empty);
+	ISLAND_CHECK(Pyramid.GetState(1, FIntVector(0)) == EVoxelOccupancyState::Empty);
+	ISLAND_CHECK_EQUAL(Pyramid.GetNumKnownCells(), 8);
+
+	Pyramid.SetCellState(FIntVector(1, 0, 1), EVoxelOccupancyState::Full);
+	ISLAND_CHECK(Pyramid.GetState(1, FIntVector(0)) == EVoxelOccupancyState::Mixed);
+
+	// A mixed child makes every ancestor mixed, known or not
+	ISLAND_CHECK(Pyramid.GetState(2, FIntVector(0)) == EVoxelOccupancyState::Mixed);
+
+	// Edits forget the cell and its ancestors, but not its siblings
+	Pyramid.Invalidate(FIntVector(20, 3, 20), FIntVector(20, 3, 20));
+	ISLAND_CHECK(Pyramid.GetCellState(FIntVector(1, 0, 1)) == EVoxelOccupancyState::Unknown);
+	ISLAND_CHECK(Pyramid.GetState(1, FIntVector(0)) == EVoxelOccupancyState::Unknown);
+	ISLAND_CHECK(Pyramid.GetCellState(FIntVector(0, 0, 0)) == EVoxelOccupancyState::Empty);
+	ISLAND_CHECK_EQUAL(Pyramid.GetNumKnownCells(), 7);
+
+	Pyramid.Reset();
+	ISLAND_CHECK_EQUAL(Pyramid.GetNumKnownCells(), 0);
+}
+
+ISLAND_TEST(OccupancyPyramid, DetectionSkipsKnownCells)
+{
+	FVoxelSyntheticRandom Random(21);
+	FVoxelData Data;
+	const FVoxelIslandEditShape Shape = FVoxelSyntheticGrids::AddRandomStructures(Data, Random, 48, 8);
+	FVoxelSyntheticGrids::Carve(Data, Shape);
+
+	const FIntVector SearchMin(-49, -49, -5);
+	const FIntVector SearchMax(49, 49, 45);
+	FVoxelIslandDetectionSettings Settings;
+	Settings.MaxFloodFillIterations = 10000000;
+
+	const auto Expected = FVoxelSyntheticGrids::Canonicalize(FVoxelIslandDetector::DetectIslands(Data, SearchMin, SearchMax, Shape, Settings));
+
+	FVoxelOccupancyPyramid Pyramid;
+	Data.ResetQueryCounts();
+	const auto Cold = FVoxelSyntheticGrids::Canonicalize(FVoxelIslandDetector::DetectIslands(Data, SearchMin, SearchMax, Shape, Settings, nullptr, &Pyramid));
+	const int64 ColdQueries = Data.GetNumBulkQueries();
+	ISLAND_CHECK(Cold == Expected);
+	ISLAND_CHECK(Pyramid.GetNumKnownCells() > 0);
+
+	Data.ResetQueryCounts();
+	const auto Warm = FVoxelSyntheticGrids::Canonicalize(FVoxelIslandDetector::DetectIslands(Data, SearchMin, SearchMax, Shape, Settings, nullptr, &Pyramid));
+	ISLAND_CHECK(Warm == Expected);
+	ISLAND_CHECK(Data.GetNumBulkQueries() < ColdQueries);
+
+	// The slab below the towers is solid all the way through
+	ISLAND_CHECK(Pyramid.GetCellState(FVoxelOccupancyPyramid::GetCellCoord(FIntVector(0, 0, -2))) != EVoxelOccupancyState::Empty);
+}
+
+ISLAND_TEST(OccupancyPyramid, GraphUsesPyramid)
+{
+	FVoxelData Data;
+	FVoxelSyntheticGrids::AddGround(Data, 40, 40);
+	FVoxelSyntheticGrids::AddTower(Data, 0, 0, 5, 40);
+
+	FVoxelIslandEditShape Shape;
+	Shape.AddSphere(FIntVector(2, 2, 10), 4);
+	FVoxelSyntheticGrids::Carve(Data, Shape);
+
+	FIntVector Min, Max;
+	Shape.GetBounds(1, Min, Max);
+	const FVoxelIslandDetectionSettings Settings;
+
+	FVoxelConnectivityGraph Plain;
+	const auto Expected = FVoxelSyntheticGrids::Canonicalize(Plain.FindSeveredIslands(Data, Min, Max, Settings));
+	ISLAND_CHECK_EQUAL(int32(Expected.size()), 1);
+
+	FVoxelOccupancyPyramid Pyramid;
+	FVoxelConnectivityGraph Graph;
+	Graph.SetOccupancyPyramid(&Pyramid);
+	ISLAND_CHECK(FVoxelSyntheticGrids::Canonicalize(Graph.FindSeveredIslands(Data, Min, Max, Settings)) == Expected);
+	ISLAND_CHECK(Pyramid.GetNumKnownCells() > 0);
+
+	// Rebuilding from the pyramid alone reads fewer clusters and gives the same answer
+	Graph.Reset();
+	Data.ResetQueryCounts();
+	ISLAND_CHECK(FVoxelSyntheticGrids::Canonicalize(Graph.FindSeveredIslands(Data, Min, Max, Settings)) == Expected);
+	const int64 WarmQueries = Data.GetNumBulkQueries();
+
+	Plain.Reset();
+	Data.ResetQueryCounts();
+	Plain.FindSeveredIslands(Data, Min, Max, Settings);
+	ISLAND_CHECK(WarmQueries < Data.GetNumBulkQueries());
+}
@@ -0,0 +1,59 @@
+// TestResultCache.cpp
+#include "IslandCoreTest.h"
+#include "VoxelConnectivityGraph.h"
+#include "VoxelIslandResultCache.h"
+#include "VoxelSyntheticGrids.h"
+
+ISLAND_TEST(ResultCache, HitsUntilReadRegionChanges)
+{
+	FVoxelData Data;
+	FVoxelSyntheticGrids::AddGround(Data, 40, 4);
+	FVoxelSyntheticGrids::AddTower(Data, 0, 0, 5, 40);
+
+	FVoxelIslandEditShape Shape;
+	Shape.AddSphere(FIntVector(2, 2, 10), 4);
+
+	FVoxelIslandResultCache Cache;
+	FVoxelConnectivityGraph Graph;
+	const FVoxelIslandDetectionSettings Settings;
+	const uint32 SettingsHash = 7;
+
+	// Same flow as a dig: verify the edit, reuse a cached answer or search and record what was read.
+	// Returns 1000 + islands on a hit.
+	auto Check = [&]()
+	{
+		FIntVector Min, Max;
+		Shape.GetBounds(1, Min, Max);
+		Cache.VerifyEdited(Data, Min, Max);
+		Graph.Invalidate(Min, Max);
+		if (const TArray<FVoxelIsland>* Cached = Cache.Find(Shape, SettingsHash))
+		{
+			return 1000 + Cached->Num();
+		}
+
+		const uint64 StartGeneration = Cache.GetGeneration();
+		const TArray<FVoxelIsland> Islands = Graph.FindSeveredIslands(Data, Min, Max, Settings);
+		FIntVector ClusterMin, ClusterMax;
+		Graph.GetLastQueryClusters(ClusterMin, ClusterMax);
+		Cache.Add(Shape, SettingsHash, (ClusterMin - FIntVector(1)) * 16, (ClusterMax + FIntVector(2)) * 16 - FIntVector(1), StartGeneration, Islands);
+		return Islands.Num();
+	};
+
+	ISLAND_CHECK_EQUAL(Check(), 0);
+	ISLAND_CHECK_EQUAL(Check(), 1000);
+
+	FVoxelSyntheticGrids::Carve(Data, Shape);
+	ISLAND_CHECK_EQUAL(Check(), 1);
+	ISLAND_CHECK_EQUAL(Check(), 1001);
+
+	// Edits far from anything the search read keep the entry; edits inside it drop it
+	Cache.MarkEdited(FIntVector(-300, -30, 0), FIntVector(-300, -30, 0));
+	ISLAND_CHECK_EQUAL(Check(), 1001);
+	ISLAND_CHECK(!Cache.HasChangedSince(FIntVector(0, 0, -4), FIntVector(4, 4, 40), Cache.GetGeneration()));
+
+	const uint64 BeforeEdit = Cache.GetGeneration();
+	Cache.MarkEdited(FIntVector(1, 1, -1), FIntVector(1, 1, -1));
+	ISLAND_CHECK(Cache.HasChangedSince(FIntVector(0, 0, -4), FIntVector(4, 4, 40), BeforeEdit));
+	ISLAND_CHECK_EQUAL(Check(), 1);
+	ISLAND_CHECK(Cache.GetNumEntries() <= FVoxelIslandResultCache::MaxEntries);
+}